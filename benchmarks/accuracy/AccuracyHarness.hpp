@@ -0,0 +1,75 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __ACCURACYHARNESS_HPP
+#define __ACCURACYHARNESS_HPP
+
+#include <Sunriset/SolarGrid.hpp>
+#include <Sunriset/SolarTypes.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace accuracy {
+
+  enum class Quantity { RiseSet, DayLength };
+
+  struct SweepDay {
+    int year, month, day;
+    long days; // days_since_2000_Jan_0
+  };
+
+  // Observers of one date and event: the regular lattice first (row-major, as
+  // sunrisetGrid lays it out), then points straddling the latitudes where cost = +-1.
+  // Every coordinate is exactly representable as a float, so the single-precision
+  // candidates see the same inputs as the reference.
+  struct Points {
+    std::vector<double> lon, lat;
+    std::vector<float> lonF, latF;
+    std::size_t latticeCount = 0;
+    dotname::GridSpec lattice{};
+
+    std::size_t size () const {
+      return lon.size ();
+    }
+  };
+
+  // rise/set, or the day length in `rise` for Quantity::DayLength; hours.
+  // riseF/setF are scratch for the single-precision candidates, which widen into rise/set.
+  struct Outputs {
+    std::vector<double> rise, set;
+    std::vector<float> riseF, setF;
+    std::vector<std::int8_t> status;
+
+    void resize (std::size_t n) {
+      rise.resize (n);
+      set.resize (n);
+      riseF.resize (n);
+      setF.resize (n);
+      status.resize (n);
+    }
+  };
+
+  // The bound a candidate documents against the C code. exact: bit-identical results
+  // and status codes are promised, any difference fails.
+  struct Budget {
+    double seconds;
+    bool exact;
+  };
+
+  struct Candidate {
+    std::string name;
+    Quantity quantity;
+    Budget budget;
+    bool latticeOnly; // evaluates the regular lattice only (sunrisetGrid)
+    std::function<void (const SweepDay&, const Points&, dotname::SolarEvent, Outputs&)> run;
+  };
+
+  std::vector<Candidate> candidates ();
+
+} // namespace accuracy
+
+#endif // __ACCURACYHARNESS_HPP
@@ -0,0 +1,251 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+// Every alternative to __sunriset__ / __daylen__ the library ships, with the bound its
+// header documents. A new fast path gets an entry here together with its doc comment.
+
+#include "AccuracyHarness.hpp"
+
+#include <Sunriset/Batch.hpp>
+#include <Sunriset/BatchExecutor.hpp>
+#include <Sunriset/ChebyshevEphemeris.hpp>
+#include <Sunriset/EphemerisTable.hpp>
+#include <Sunriset/SolarConstexpr.hpp>
+#include <Sunriset/SolarCore.hpp>
+#include <Sunriset/SolarDay.hpp>
+#include <Sunriset/SolarGrid.hpp>
+#include <Sunriset/SolarKernels.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+
+namespace accuracy {
+
+  namespace {
+
+    using dotname::SimdLevel;
+    using dotname::SolarEvent;
+
+    // Rounding-level differences (reordered or constexpr arithmetic): far below 1e-6 s
+    constexpr Budget kRounding{ 1e-6, false };
+    constexpr Budget kExact{ 0.0, true };
+
+    template <SolarEvent E> using EventTag = std::integral_constant<SolarEvent, E>;
+
+    // Calls f (EventTag<E>{}) with the runtime event turned into a template argument
+    template <class F> void withEvent (SolarEvent event, F f) {
+      switch (event) {
+      case SolarEvent::SunriseSunset:
+        return f (EventTag<SolarEvent::SunriseSunset>{});
+      case SolarEvent::CivilTwilight:
+        return f (EventTag<SolarEvent::CivilTwilight>{});
+      case SolarEvent::NauticalTwilight:
+        return f (EventTag<SolarEvent::NauticalTwilight>{});
+      case SolarEvent::AstronomicalTwilight:
+        return f (EventTag<SolarEvent::AstronomicalTwilight>{});
+      }
+    }
+
+    void store (Outputs& out, std::size_t i, const dotname::core::RiseSet& rs) {
+      out.rise[i] = rs.rise;
+      out.set[i] = rs.set;
+      out.status[i] = static_cast<std::int8_t> (rs.rc);
+    }
+
+    // Levels the running CPU can execute, widest last
+    std::vector<SimdLevel> simdLevels () {
+      std::vector<SimdLevel> levels{ SimdLevel::Scalar };
+      for (SimdLevel level : { SimdLevel::Sse2, SimdLevel::Avx2, SimdLevel::Avx512 })
+        if (level <= dotname::simdLevel ())
+          levels.push_back (level);
+      return levels;
+    }
+
+    void addRiseSet (std::vector<Candidate>& all) {
+      all.push_back ({ "core::sunriset", Quantity::RiseSet, kExact, false,
+                       [] (const SweepDay& day, const Points& p, SolarEvent event, Outputs& out) {
+                         const dotname::SolarEventParams params
+                             = dotname::solarEventParams (event);
+                         for (std::size_t i = 0; i < p.size (); ++i)
+                           store (out, i,
+                                  dotname::core::sunriset (day.days, p.lon[i], p.lat[i],
+                                                           params.altit, params.upperLimb));
+                       } });
+
+      all.push_back ({ "sunrisetBatch", Quantity::RiseSet, kExact, false,
+                       [] (const SweepDay& day, const Points& p, SolarEvent event, Outputs& out) {
+                         dotname::sunrisetBatch (day.year, day.month, day.day, p.lon.data (),
+                                                 p.lat.data (), p.size (), out.rise.data (),
+                                                 out.set.data (), out.status.data (), event);
+                       } });
+
+      // Batch.hpp: within 2e-9 hours
+      for (SimdLevel level : simdLevels ()) {
+        if (level == SimdLevel::Scalar)
+          continue;
+        all.push_back (
+            { std::string ("sunrisetBatchVectorized/") + dotname::simdLevelName (level),
+              Quantity::RiseSet, Budget{ 1e-5, false }, false,
+              [level] (const SweepDay& day, const Points& p, SolarEvent event, Outputs& out) {
+                dotname::sunrisetBatchVectorized (day.year, day.month, day.day, p.lon.data (),
+                                                  p.lat.data (), p.size (), out.rise.data (),
+                                                  out.set.data (), out.status.data (), event,
+                                                  level);
+              } });
+      }
+
+      // Batch.hpp: within 16 s up to |lat| 88
+      for (SimdLevel level : simdLevels ()) {
+        all.push_back (
+            { std::string ("sunrisetBatchFloat/") + dotname::simdLevelName (level),
+              Quantity::RiseSet, Budget{ 16.0, false }, false,
+              [level] (const SweepDay& day, const Points& p, SolarEvent event, Outputs& out) {
+                dotname::sunrisetBatchFloat (day.year, day.month, day.day, p.lonF.data (),
+                                             p.latF.data (), p.size (), out.riseF.data (),
+                                             out.setF.data (), out.status.data (), event, level);
+                std::copy (out.riseF.begin (), out.riseF.end (), out.rise.begin ());
+                std::copy (out.setF.begin (), out.setF.end (), out.set.begin ());
+              } });
+      }
+
+      // EphemerisTable.hpp: 0.1 s with one sample a day, 0.4 ms with four
+      for (int samples : { 1, 4 }) {
+        auto table = std::make_shared<dotname::EphemerisTable> (samples);
+        all.push_back ({ "EphemerisTable/" + std::to_string (samples) + "perDay",
+                         Quantity::RiseSet, Budget{ samples == 1 ? 0.1 : 4e-4, false }, false,
+                         [table] (const SweepDay& day, const Points& p, SolarEvent event,
+                                  Outputs& out) {
+                           table->sunrisetBatch (day.year, day.month, day.day, p.lon.data (),
+                                                 p.lat.data (), p.size (), out.rise.data (),
+                                                 out.set.data (), out.status.data (), event);
+                         } });
+      }
+
+      // ChebyshevEphemeris.hpp: within 3e-6 s
+      {
+        auto ephemeris = std::make_shared<dotname::ChebyshevEphemeris> ();
+        all.push_back ({ "ChebyshevEphemeris", Quantity::RiseSet, Budget{ 3e-6, false }, false,
+                         [ephemeris] (const SweepDay& day, const Points& p, SolarEvent event,
+                                      Outputs& out) {
+                           ephemeris->sunrisetBatch (day.year, day.month, day.day, p.lon.data (),
+                                                     p.lat.data (), p.size (), out.rise.data (),
+                                                     out.set.data (), out.status.data (), event);
+                         } });
+      }
+
+      all.push_back ({ "sunrisetFor<E>", Quantity::RiseSet, kRounding, false,
+                       [] (const SweepDay& day, const Points& p, SolarEvent event, Outputs& out) {
+                         withEvent (event, [&] (auto tag) {
+                           for (std::size_t i = 0; i < p.size (); ++i)
+                             store (out, i,
+                                    dotname::sunrisetFor<decltype (tag)::value> (
+                                        day.days, p.lon[i], p.lat[i]));
+                         });
+                       } });
+
+      all.push_back ({ "cx::sunriset", Quantity::RiseSet, kRounding, false,
+                       [] (const SweepDay& day, const Points& p, SolarEvent event, Outputs& out) {
+                         const dotname::SolarEventParams params
+                             = dotname::solarEventParams (event);
+                         for (std::size_t i = 0; i < p.size (); ++i)
+                           store (out, i,
+                                  dotname::cx::sunriset (day.days, p.lon[i], p.lat[i],
+                                                         params.altit, params.upperLimb));
+                       } });
+
+      all.push_back ({ "solarDayBatch", Quantity::RiseSet, kExact, false,
+                       [] (const SweepDay& day, const Points& p, SolarEvent event, Outputs& out) {
+                         std::vector<dotname::SolarDay> days (p.size ());
+                         dotname::solarDayBatch (day.year, day.month, day.day, p.lon.data (),
+                                                 p.lat.data (), p.size (), days.data ());
+                         for (std::size_t i = 0; i < p.size (); ++i) {
+                           const dotname::SolarEventTimes& t = days[i][event];
+                           out.rise[i] = t.start;
+                           out.set[i] = t.end;
+                           out.status[i] = t.status;
+                         }
+                       } });
+
+      // SolarGrid.hpp: tracks the 0.5 s tolerance, worst 0.51 s
+      all.push_back ({ "sunrisetGrid", Quantity::RiseSet, Budget{ 0.6, false }, true,
+                       [] (const SweepDay& day, const Points& p, SolarEvent event, Outputs& out) {
+                         dotname::GridOptions options;
+                         options.event = event;
+                         dotname::sunrisetGrid (day.year, day.month, day.day, p.lattice, options,
+                                                out.rise.data (), out.set.data (), nullptr,
+                                                out.status.data ());
+                       } });
+
+      auto executor = std::make_shared<dotname::BatchExecutor> ();
+      all.push_back ({ "BatchExecutor::sunriset/Auto", Quantity::RiseSet, Budget{ 1e-5, false },
+                       false,
+                       [executor] (const SweepDay& day, const Points& p, SolarEvent event,
+                                   Outputs& out) {
+                         executor->sunriset (day.year, day.month, day.day, 1, p.lon.data (),
+                                             p.lat.data (), p.size (), out.rise.data (),
+                                             out.set.data (), out.status.data (), event,
+                                             SimdLevel::Auto);
+                       } });
+    }
+
+    void addDayLength (std::vector<Candidate>& all) {
+      all.push_back ({ "core::daylen", Quantity::DayLength, kExact, false,
+                       [] (const SweepDay& day, const Points& p, SolarEvent event, Outputs& out) {
+                         const dotname::SolarEventParams params = dotname::dayLengthParams (event);
+                         for (std::size_t i = 0; i < p.size (); ++i)
+                           out.rise[i] = dotname::core::daylen (day.days, p.lon[i], p.lat[i],
+                                                                params.altit, params.upperLimb);
+                       } });
+
+      all.push_back ({ "daylenFor<E>", Quantity::DayLength, kRounding, false,
+                       [] (const SweepDay& day, const Points& p, SolarEvent event, Outputs& out) {
+                         withEvent (event, [&] (auto tag) {
+                           for (std::size_t i = 0; i < p.size (); ++i)
+                             out.rise[i] = dotname::daylenFor<decltype (tag)::value> (
+                                 day.days, p.lon[i], p.lat[i]);
+                         });
+                       } });
+
+      all.push_back ({ "cx::daylen", Quantity::DayLength, kRounding, false,
+                       [] (const SweepDay& day, const Points& p, SolarEvent event, Outputs& out) {
+                         const dotname::SolarEventParams params = dotname::dayLengthParams (event);
+                         for (std::size_t i = 0; i < p.size (); ++i)
+                           out.rise[i] = dotname::cx::daylen (day.days, p.lon[i], p.lat[i],
+                                                              params.altit, params.upperLimb);
+                       } });
+
+      // SolarDay.hpp: day lengths agree to rounding
+      all.push_back ({ "solarDayBatch", Quantity::DayLength, kRounding, false,
+                       [] (const SweepDay& day, const Points& p, SolarEvent event, Outputs& out) {
+                         std::vector<dotname::SolarDay> days (p.size ());
+                         dotname::solarDayBatch (day.year, day.month, day.day, p.lon.data (),
+                                                 p.lat.data (), p.size (), days.data ());
+                         for (std::size_t i = 0; i < p.size (); ++i) {
+                           const dotname::SolarDay& s = days[i];
+                           const double lengths[]
+                               = { s.dayLength, s.civilTwilightLength, s.nauticalTwilightLength,
+                                   s.astronomicalTwilightLength };
+                           out.rise[i] = lengths[static_cast<std::size_t> (event)];
+                         }
+                       } });
+
+      auto executor = std::make_shared<dotname::BatchExecutor> ();
+      all.push_back ({ "BatchExecutor::daylen", Quantity::DayLength, kExact, false,
+                       [executor] (const SweepDay& day, const Points& p, SolarEvent event,
+                                   Outputs& out) {
+                         executor->daylen (day.year, day.month, day.day, 1, p.lon.data (),
+                                           p.lat.data (), p.size (), out.rise.data (), event);
+                       } });
+    }
+
+  } // namespace
+
+  std::vector<Candidate> candidates () {
+    std::vector<Candidate> all;
+    addRiseSet (all);
+    addDayLength (all);
+    return all;
+  }
+
+} // namespace accuracy
@@ -0,0 +1,368 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+// SunrisetAccuracy: runs the reference sunriset.c and every candidate of Candidates.cpp
+// over the same sweep of dates, latitudes and longitudes and prints, per candidate and
+// event, the max/mean error in seconds, the mismatched status codes and the measured
+// throughput next to the documented budget. Exits with 1 when a candidate breaks its
+// budget, so the table can gate a change.
+
+#include "AccuracyHarness.hpp"
+
+#include <Sunriset/Batch.hpp>
+#include <Sunriset/SolarCore.hpp>
+#include <Sunriset/Sunriset.hpp>
+
+#include <cxxopts.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+  using accuracy::Candidate;
+  using accuracy::Outputs;
+  using accuracy::Points;
+  using accuracy::Quantity;
+  using accuracy::SweepDay;
+  using dotname::SolarEvent;
+  using Clock = std::chrono::steady_clock;
+
+  constexpr SolarEvent kEvents[] = { SolarEvent::SunriseSunset, SolarEvent::CivilTwilight,
+                                     SolarEvent::NauticalTwilight,
+                                     SolarEvent::AstronomicalTwilight };
+  constexpr const char* kEventNames[] = { "rise/set", "civil", "nautical", "astronomical" };
+
+  // Offsets (degrees) around each latitude where cost = +-1
+  constexpr double kCutoffOffsets[] = { -1e-2, -1e-4, 0.0, 1e-4, 1e-2 };
+
+  struct Options {
+    int dateStep;
+    double latStep;
+    double lonStep;
+    double maxLat;
+    std::string filter;
+    std::string csv;
+  };
+
+  struct Stats {
+    std::size_t compared = 0;
+    std::size_t mismatched = 0; // status codes differ, times not compared
+    std::size_t wrapped = 0;    // times equal modulo 24 h only
+    double maxSeconds = 0.0;
+    double sumSeconds = 0.0;
+    SweepDay worstDay{};
+    double worstLat = 0.0, worstLon = 0.0;
+
+    double meanSeconds () const {
+      return compared ? sumSeconds / static_cast<double> (compared) : 0.0;
+    }
+  };
+
+  // The lattice is what a budget promises. Next to cost = +-1 the rise/set time is
+  // ill-conditioned (d acos / d cost grows without bound), so any rounding difference is
+  // amplified there; that band is reported on its own and only gates exact candidates.
+  struct Result {
+    Stats lattice;
+    Stats cutoff;
+    double elapsed = 0.0; // seconds spent in the candidate
+    std::size_t results = 0;
+  };
+
+  bool isLeapYear (int year) {
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+  }
+
+  void nextDate (int& year, int& month, int& day) {
+    static const int length[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    const int last = length[month - 1] + (month == 2 && isLeapYear (year) ? 1 : 0);
+    if (++day > last) {
+      day = 1;
+      if (++month > 12)
+        month = 1, ++year;
+    }
+  }
+
+  std::vector<SweepDay> sweepDays (int step) {
+    std::vector<SweepDay> days;
+    int year = 1801, month = 1, day = 1;
+    for (int k = 0; year < 2100; ++k, nextDate (year, month, day))
+      if (k % step == 0)
+        days.push_back ({ year, month, day, dotname::core::daysSince2000Jan0 (year, month, day) });
+    return days;
+  }
+
+  // Steps snapped to 1/1024 degree keep lat0 + i * step exact in float as well
+  double snapStep (double step) {
+    return std::max (1.0, std::round (step * 1024.0)) / 1024.0;
+  }
+
+  void addPoint (Points& p, double lon, double lat) {
+    const float lonF = static_cast<float> (lon);
+    const float latF = static_cast<float> (std::clamp (lat, -90.0, 90.0));
+    p.lon.push_back (lonF);
+    p.lat.push_back (latF);
+    p.lonF.push_back (lonF);
+    p.latF.push_back (latF);
+  }
+
+  Points buildPoints (const SweepDay& day, dotname::SolarEventParams params,
+                      const Options& options) {
+    Points p;
+    const double latStep = snapStep (options.latStep);
+    const double lonStep = snapStep (options.lonStep);
+    const double rows = std::floor (std::min (options.maxLat, 90.0) / latStep);
+    p.lattice = { -rows * latStep, latStep, 2 * static_cast<std::size_t> (rows) + 1, -180.0,
+                  lonStep, static_cast<std::size_t> (std::ceil (360.0 / lonStep)) };
+    for (std::size_t i = 0; i < p.lattice.nLat; ++i)
+      for (std::size_t j = 0; j < p.lattice.nLon; ++j)
+        addPoint (p, p.lattice.lon0 + j * lonStep, p.lattice.lat0 + i * latStep);
+    p.latticeCount = p.size ();
+
+    // cost = +1 where cos (lat - dec) = sin h, cost = -1 where cos (lat + dec) = -sin h
+    for (std::size_t j = 0; j < p.lattice.nLon; ++j) {
+      const double lon = p.lattice.lon0 + j * lonStep;
+      double ra, dec, r;
+      sun_RA_dec (day.days + 0.5 - lon / 360.0, &ra, &dec, &r);
+      const double h = params.altit - (params.upperLimb ? 0.2666 / r : 0.0);
+      for (double cutoff : { dec - 90.0 + h, dec + 90.0 - h, 90.0 + h - dec, -90.0 - h - dec }) {
+        if (std::fabs (cutoff) > std::min (options.maxLat, 90.0))
+          continue;
+        for (double offset : kCutoffOffsets)
+          addPoint (p, lon, cutoff + offset);
+      }
+    }
+    return p;
+  }
+
+  void reference (const SweepDay& day, const Points& p, Quantity quantity,
+                  dotname::SolarEventParams params, Outputs& out) {
+    for (std::size_t i = 0; i < p.size (); ++i) {
+      if (quantity == Quantity::RiseSet) {
+        out.status[i] = static_cast<std::int8_t> (
+            __sunriset__ (day.year, day.month, day.day, p.lon[i], p.lat[i], params.altit,
+                          params.upperLimb, &out.rise[i], &out.set[i]));
+      } else {
+        out.rise[i] = __daylen__ (day.year, day.month, day.day, p.lon[i], p.lat[i],
+                                  params.altit, params.upperLimb);
+      }
+    }
+  }
+
+  // Day lengths carry their polar branch in the value: 0 h polar night, 24 h polar day
+  std::int8_t lengthStatus (double length) {
+    return length == 0.0 ? -1 : (length == 24.0 ? 1 : 0);
+  }
+
+  double timeError (double a, double b, Stats& stats) {
+    const double d = std::fabs (a - b);
+    if (d > 12.0) {
+      ++stats.wrapped;
+      return std::fabs (d - 24.0);
+    }
+    return d;
+  }
+
+  void compare (const SweepDay& day, const Points& p, Quantity quantity, std::size_t begin,
+                std::size_t end, const Outputs& ref, const Outputs& got, Stats& stats) {
+    for (std::size_t i = begin; i < end; ++i) {
+      double hours;
+      if (quantity == Quantity::RiseSet) {
+        if (ref.status[i] != got.status[i]) {
+          ++stats.mismatched;
+          continue;
+        }
+        hours = std::max (timeError (ref.rise[i], got.rise[i], stats),
+                          timeError (ref.set[i], got.set[i], stats));
+      } else {
+        if (lengthStatus (ref.rise[i]) != lengthStatus (got.rise[i])) {
+          ++stats.mismatched;
+          continue;
+        }
+        hours = std::fabs (ref.rise[i] - got.rise[i]);
+      }
+
+      const double seconds = hours * 3600.0;
+      ++stats.compared;
+      stats.sumSeconds += seconds;
+      if (seconds > stats.maxSeconds || std::isnan (seconds)) {
+        stats.maxSeconds = std::isnan (seconds) ? INFINITY : seconds;
+        stats.worstDay = day;
+        stats.worstLat = p.lat[i];
+        stats.worstLon = p.lon[i];
+      }
+    }
+  }
+
+  bool identical (const Stats& stats) {
+    return stats.maxSeconds == 0.0 && stats.mismatched == 0 && stats.wrapped == 0;
+  }
+
+  bool withinBudget (const Candidate& candidate, const Result& result) {
+    if (candidate.budget.exact)
+      return identical (result.lattice) && identical (result.cutoff);
+    return result.lattice.maxSeconds <= candidate.budget.seconds;
+  }
+
+  double nsPerResult (const Result& result) {
+    return result.results ? result.elapsed * 1e9 / static_cast<double> (result.results) : 0.0;
+  }
+
+  std::string budgetText (const accuracy::Budget& budget) {
+    if (budget.exact)
+      return "exact";
+    char text[16];
+    std::snprintf (text, sizeof text, "%.2g", budget.seconds);
+    return text;
+  }
+
+  std::string formatDay (const SweepDay& day) {
+    char text[16];
+    std::snprintf (text, sizeof text, "%04d-%02d-%02d", day.year, day.month, day.day);
+    return text;
+  }
+
+  int run (const Options& options) {
+    std::vector<Candidate> all;
+    for (Candidate& candidate : accuracy::candidates ())
+      if (candidate.name.find (options.filter) != std::string::npos)
+        all.push_back (std::move (candidate));
+
+    const std::vector<SweepDay> days = sweepDays (options.dateStep);
+    const std::size_t eventCount = std::size (kEvents);
+    std::vector<Result> results (all.size () * eventCount);
+    Result referenceResults[2];
+
+    Outputs ref, got;
+    for (const SweepDay& day : days) {
+      for (std::size_t e = 0; e < eventCount; ++e) {
+        for (Quantity quantity : { Quantity::RiseSet, Quantity::DayLength }) {
+          const dotname::SolarEventParams params = quantity == Quantity::RiseSet
+                                                       ? dotname::solarEventParams (kEvents[e])
+                                                       : dotname::dayLengthParams (kEvents[e]);
+          const Points p = buildPoints (day, params, options);
+          ref.resize (p.size ());
+          got.resize (p.size ());
+
+          Result& refResult = referenceResults[quantity == Quantity::RiseSet ? 0 : 1];
+          const Clock::time_point start = Clock::now ();
+          reference (day, p, quantity, params, ref);
+          refResult.elapsed += std::chrono::duration<double> (Clock::now () - start).count ();
+          refResult.results += p.size ();
+
+          for (std::size_t c = 0; c < all.size (); ++c) {
+            if (all[c].quantity != quantity)
+              continue;
+            Result& r = results[c * eventCount + e];
+            const std::size_t count = all[c].latticeOnly ? p.latticeCount : p.size ();
+            const Clock::time_point begin = Clock::now ();
+            all[c].run (day, p, kEvents[e], got);
+            r.elapsed += std::chrono::duration<double> (Clock::now () - begin).count ();
+            r.results += count;
+            compare (day, p, quantity, 0, p.latticeCount, ref, got, r.lattice);
+            compare (day, p, quantity, p.latticeCount, count, ref, got, r.cutoff);
+          }
+        }
+      }
+    }
+
+    std::printf ("sweep: %zu dates (every %d days, 1801-2099), lattice %.4g x %.4g deg up to "
+                 "|lat| %.4g; cutoff band +-1e-2/1e-4/0 deg around the cost = +-1 latitudes; "
+                 "SIMD %s\n",
+                 days.size (), options.dateStep, snapStep (options.latStep),
+                 snapStep (options.lonStep), std::min (options.maxLat, 90.0),
+                 dotname::simdLevelName (dotname::simdLevel ()));
+    std::printf ("reference: __sunriset__ %.1f ns/result, __daylen__ %.1f ns/result\n",
+                 nsPerResult (referenceResults[0]), nsPerResult (referenceResults[1]));
+    std::printf ("budgets apply to the lattice; the cutoff band only gates exact candidates\n\n");
+    std::printf ("%-30s %-12s | %9s %10s %10s %6s | %8s %10s %6s | %5s %9s %8s  %s\n",
+                 "candidate", "event", "lattice", "max s", "mean s", "rc", "cutoff", "max s", "rc",
+                 "wrap", "ns/result", "budget", "verdict");
+
+    std::ofstream csv;
+    if (!options.csv.empty ()) {
+      csv.open (options.csv);
+      csv << "candidate,quantity,event,lattice_compared,lattice_max_s,lattice_mean_s,"
+             "lattice_rc_mismatch,cutoff_compared,cutoff_max_s,cutoff_mean_s,cutoff_rc_mismatch,"
+             "wrap24,ns_per_result,budget_s,within_budget,worst_date,worst_lat,worst_lon\n";
+    }
+
+    bool allWithin = true;
+    for (Quantity quantity : { Quantity::RiseSet, Quantity::DayLength }) {
+      std::printf ("-- %s\n", quantity == Quantity::RiseSet ? "rise/set vs __sunriset__"
+                                                            : "day length vs __daylen__");
+      for (std::size_t c = 0; c < all.size (); ++c) {
+        if (all[c].quantity != quantity)
+          continue;
+        for (std::size_t e = 0; e < eventCount; ++e) {
+          const Result& r = results[c * eventCount + e];
+          const Stats& l = r.lattice;
+          const Stats& b = r.cutoff;
+          const bool within = withinBudget (all[c], r);
+          allWithin = allWithin && within;
+          std::printf ("%-30s %-12s | %9zu %10.3e %10.3e %6zu | %8zu %10.3e %6zu | %5zu %9.1f %8s  %s",
+                       all[c].name.c_str (), kEventNames[e], l.compared, l.maxSeconds,
+                       l.meanSeconds (), l.mismatched, b.compared, b.maxSeconds, b.mismatched,
+                       l.wrapped + b.wrapped, nsPerResult (r),
+                       budgetText (all[c].budget).c_str (), within ? "ok" : "OVER");
+          if (l.maxSeconds > 0.0)
+            std::printf ("  worst %s lat %.6f lon %.3f", formatDay (l.worstDay).c_str (),
+                         l.worstLat, l.worstLon);
+          std::printf ("\n");
+
+          if (csv.is_open ())
+            csv << all[c].name << ',' << (quantity == Quantity::RiseSet ? "riseset" : "daylen")
+                << ',' << kEventNames[e] << ',' << l.compared << ',' << l.maxSeconds << ','
+                << l.meanSeconds () << ',' << l.mismatched << ',' << b.compared << ','
+                << b.maxSeconds << ',' << b.meanSeconds () << ',' << b.mismatched << ','
+                << l.wrapped + b.wrapped << ',' << nsPerResult (r) << ','
+                << (all[c].budget.exact ? 0.0 : all[c].budget.seconds) << ',' << (within ? 1 : 0)
+                << ',' << formatDay (l.worstDay) << ',' << l.worstLat << ',' << l.worstLon
+                << '\n';
+        }
+      }
+    }
+    return allWithin ? 0 : 1;
+  }
+
+} // namespace
+
+int main (int argc, const char* argv[]) {
+  try {
+    cxxopts::Options options (argv[0], "SunrisetAccuracy");
+    options.set_width (80);
+    options.add_options () ("h,help", "Show help");
+    options.add_options () ("date-step", "Days between swept dates",
+                            cxxopts::value<int> ()->default_value ("29"));
+    options.add_options () ("lat-step", "Lattice latitude step, degrees",
+                            cxxopts::value<double> ()->default_value ("2"));
+    options.add_options () ("lon-step", "Lattice longitude step, degrees",
+                            cxxopts::value<double> ()->default_value ("30"));
+    options.add_options () ("max-lat", "Largest |latitude| swept, degrees",
+                            cxxopts::value<double> ()->default_value ("90"));
+    options.add_options () ("filter", "Only candidates whose name contains this",
+                            cxxopts::value<std::string> ()->default_value (""));
+    options.add_options () ("csv", "Also write the table to this file",
+                            cxxopts::value<std::string> ()->default_value (""));
+
+    const auto result = options.parse (argc, argv);
+    if (result.count ("help")) {
+      std::cout << options.help () << std::endl;
+      return 0;
+    }
+
+    return run ({ std::max (1, result["date-step"].as<int> ()), result["lat-step"].as<double> (),
+                  result["lon-step"].as<double> (), result["max-lat"].as<double> (),
+                  result["filter"].as<std::string> (),
+                  result["csv"].as<std::string> () });
+  } catch (const std::exception& e) {
+    std::cerr << "SunrisetAccuracy: " << e.what () << std::endl;
+    return 2;
+  }
+}
@@ -0,0 +1,118 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+// Replaces the global allocation functions so benchmarks can report allocations per
+// call. Only the count is added; storage still comes from malloc.
+
+#include "BenchSupport.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+  std::atomic<std::uint64_t> allocations{ 0 };
+
+  void* allocate (std::size_t size) {
+    allocations.fetch_add (1, std::memory_order_relaxed);
+    if (void* p = std::malloc (size ? size : 1))
+      return p;
+    throw std::bad_alloc ();
+  }
+
+  void* allocateAligned (std::size_t size, std::align_val_t align) {
+    allocations.fetch_add (1, std::memory_order_relaxed);
+    const std::size_t alignment = static_cast<std::size_t> (align);
+#if defined(_MSC_VER)
+    void* p = _aligned_malloc (size ? size : 1, alignment);
+#else
+    // aligned_alloc wants the size to be a multiple of the alignment
+    void* p = std::aligned_alloc (alignment, (size + alignment - 1) / alignment * alignment);
+#endif
+    if (p)
+      return p;
+    throw std::bad_alloc ();
+  }
+
+  void releaseAligned (void* p) noexcept {
+#if defined(_MSC_VER)
+    _aligned_free (p);
+#else
+    std::free (p);
+#endif
+  }
+
+} // namespace
+
+namespace bench {
+
+  std::uint64_t allocationCount () {
+    return allocations.load (std::memory_order_relaxed);
+  }
+
+} // namespace bench
+
+void* operator new (std::size_t size) {
+  return allocate (size);
+}
+
+void* operator new[] (std::size_t size) {
+  return allocate (size);
+}
+
+void* operator new (std::size_t size, const std::nothrow_t&) noexcept {
+  try {
+    return allocate (size);
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+void* operator new[] (std::size_t size, const std::nothrow_t&) noexcept {
+  try {
+    return allocate (size);
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+void* operator new (std::size_t size, std::align_val_t align) {
+  return allocateAligned (size, align);
+}
+
+void* operator new[] (std::size_t size, std::align_val_t align) {
+  return allocateAligned (size, align);
+}
+
+void operator delete (void* p) noexcept {
+  std::free (p);
+}
+
+void operator delete[] (void* p) noexcept {
+  std::free (p);
+}
+
+void operator delete (void* p, std::size_t) noexcept {
+  std::free (p);
+}
+
+void operator delete[] (void* p, std::size_t) noexcept {
+  std::free (p);
+}
+
+void operator delete (void* p, std::align_val_t) noexcept {
+  releaseAligned (p);
+}
+
+void operator delete[] (void* p, std::align_val_t) noexcept {
+  releaseAligned (p);
+}
+
+void operator delete (void* p, std::size_t, std::align_val_t) noexcept {
+  releaseAligned (p);
+}
+
+void operator delete[] (void* p, std::size_t, std::align_val_t) noexcept {
+  releaseAligned (p);
+}
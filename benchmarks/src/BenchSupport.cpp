@@ -0,0 +1,54 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include "BenchSupport.hpp"
+
+#include <Sunriset/SolarCore.hpp>
+
+#include <cmath>
+
+namespace bench {
+
+  std::vector<Query> randomQueries (double latMin, double latMax, std::uint32_t seed) {
+    std::mt19937 rng (seed);
+    std::uniform_int_distribution<int> year (1801, 2099), month (1, 12), day (1, 28);
+    std::uniform_real_distribution<double> lon (-180.0, 180.0), lat (latMin, latMax);
+
+    std::vector<Query> queries (kQueryCount);
+    for (Query& q : queries) {
+      q.year = year (rng);
+      q.month = month (rng);
+      q.day = day (rng);
+      q.days = dotname::core::daysSince2000Jan0 (q.year, q.month, q.day);
+      q.lon = lon (rng);
+      q.lat = lat (rng);
+    }
+    return queries;
+  }
+
+  Observers globalObservers (std::size_t count, std::uint32_t seed) {
+    std::mt19937 rng (seed);
+    std::uniform_real_distribution<double> lon (-180.0, 180.0), sinLat (-1.0, 1.0);
+
+    Observers observers{ std::vector<double> (count), std::vector<double> (count) };
+    for (std::size_t i = 0; i < count; ++i) {
+      observers.lon[i] = lon (rng);
+      observers.lat[i] = std::asin (sinLat (rng)) * dotname::core::kRadeg;
+    }
+    return observers;
+  }
+
+  Observers polarObservers (std::size_t count, std::uint32_t seed) {
+    std::mt19937 rng (seed);
+    std::uniform_real_distribution<double> lon (-180.0, 180.0), lat (60.0, 90.0);
+    std::bernoulli_distribution south (0.5);
+
+    Observers observers{ std::vector<double> (count), std::vector<double> (count) };
+    for (std::size_t i = 0; i < count; ++i) {
+      observers.lon[i] = lon (rng);
+      observers.lat[i] = south (rng) ? -lat (rng) : lat (rng);
+    }
+    return observers;
+  }
+
+} // namespace bench
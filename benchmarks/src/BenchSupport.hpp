@@ -0,0 +1,97 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __BENCHSUPPORT_HPP
+#define __BENCHSUPPORT_HPP
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  #include <intrin.h>
+  #define SUNRISET_BENCH_HAS_TSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+  #include <x86intrin.h>
+  #define SUNRISET_BENCH_HAS_TSC 1
+#endif
+
+namespace bench {
+
+  // operator new calls made by any thread since start-up (AllocationCounter.cpp)
+  std::uint64_t allocationCount ();
+
+  // Time stamp counter: constant-rate reference cycles, not core clock cycles, so the
+  // figure drifts from the real cycle count when the core runs off its base frequency
+  inline std::uint64_t readCycles () {
+#if defined(SUNRISET_BENCH_HAS_TSC)
+    return __rdtsc ();
+#else
+    return 0;
+#endif
+  }
+
+  // Snapshot taken before the timing loop; report () turns the difference into per-call
+  // counters. Every benchmark reports through it so the columns stay comparable:
+  //   s/call        wall time per call (shown with SI prefix, e.g. 312n)
+  //   items/s       calls per second
+  //   allocs/call   operator new calls per call, all threads
+  //   cycles/call   TSC cycles per call (x86 only)
+  class CallProbe {
+  public:
+    CallProbe () : allocations_ (allocationCount ()), cycles_ (readCycles ()) {}
+
+    void report (benchmark::State& state, std::size_t callsPerIteration) const {
+      const std::uint64_t cycles = readCycles () - cycles_;
+      const std::uint64_t allocations = allocationCount () - allocations_;
+      const double calls
+          = static_cast<double> (state.iterations ()) * static_cast<double> (callsPerIteration);
+      if (calls == 0.0)
+        return;
+
+      state.SetItemsProcessed (static_cast<std::int64_t> (calls));
+      state.counters["s/call"] = benchmark::Counter (
+          calls, benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+      state.counters["allocs/call"] = static_cast<double> (allocations) / calls;
+#if defined(SUNRISET_BENCH_HAS_TSC)
+      state.counters["cycles/call"] = static_cast<double> (cycles) / calls;
+#else
+      (void)cycles;
+#endif
+    }
+
+  private:
+    std::uint64_t allocations_;
+    std::uint64_t cycles_;
+  };
+
+  // Inputs for the isolated-call benchmarks: a power of two, cycled through with a
+  // mask so the compiler cannot hoist the call and branches see real variety
+  struct Query {
+    int year, month, day;
+    long days; // days_since_2000_Jan_0 (year, month, day)
+    double lon, lat;
+  };
+
+  constexpr std::size_t kQueryCount = 4096;
+
+  std::vector<Query> randomQueries (double latMin, double latMax, std::uint32_t seed = 1);
+
+  // Observer sets for the workloads
+  struct Observers {
+    std::vector<double> lon;
+    std::vector<double> lat;
+  };
+
+  // Uniform over the globe's area (uniform in sin (lat)), as a 1M-point sweep would be
+  Observers globalObservers (std::size_t count, std::uint32_t seed = 2);
+
+  // |lat| in [60, 90), where cost is near +-1 and the polar-day/night branches are taken
+  Observers polarObservers (std::size_t count, std::uint32_t seed = 3);
+
+} // namespace bench
+
+#endif // __BENCHSUPPORT_HPP
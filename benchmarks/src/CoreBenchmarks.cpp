@@ -0,0 +1,189 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+// The C core and the Sunriset class wrappers, one call per iteration
+
+#include "BenchSupport.hpp"
+
+#include <Sunriset/ResultCache.hpp>
+#include <Sunriset/Sunriset.hpp>
+
+#include <string>
+
+namespace {
+
+  using bench::kQueryCount;
+  using bench::Query;
+
+  const std::vector<Query>& queries () {
+    static const std::vector<Query> all = bench::randomQueries (-89.0, 89.0);
+    return all;
+  }
+
+  // Instants d spread over 1801-2099, as the core functions take them
+  const std::vector<double>& instants () {
+    static const std::vector<double> all = [] {
+      std::vector<double> d (kQueryCount);
+      for (std::size_t i = 0; i < kQueryCount; ++i)
+        d[i] = static_cast<double> (queries ()[i].days) + 0.5 - queries ()[i].lon / 360.0;
+      return d;
+    }();
+    return all;
+  }
+
+  void coreSunriset (benchmark::State& state) {
+    const std::vector<Query>& q = queries ();
+    std::size_t i = 0;
+    double rise, set;
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      const Query& at = q[i++ & (kQueryCount - 1)];
+      benchmark::DoNotOptimize (
+          __sunriset__ (at.year, at.month, at.day, at.lon, at.lat, -35.0 / 60.0, 1, &rise, &set));
+      benchmark::DoNotOptimize (rise);
+      benchmark::DoNotOptimize (set);
+    }
+    probe.report (state, 1);
+  }
+  BENCHMARK (coreSunriset)->Name ("core/__sunriset__");
+
+  void coreDaylen (benchmark::State& state) {
+    const std::vector<Query>& q = queries ();
+    std::size_t i = 0;
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      const Query& at = q[i++ & (kQueryCount - 1)];
+      benchmark::DoNotOptimize (
+          __daylen__ (at.year, at.month, at.day, at.lon, at.lat, -35.0 / 60.0, 1));
+    }
+    probe.report (state, 1);
+  }
+  BENCHMARK (coreDaylen)->Name ("core/__daylen__");
+
+  void coreSunpos (benchmark::State& state) {
+    const std::vector<double>& d = instants ();
+    std::size_t i = 0;
+    double lon, r;
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      sunpos (d[i++ & (kQueryCount - 1)], &lon, &r);
+      benchmark::DoNotOptimize (lon);
+      benchmark::DoNotOptimize (r);
+    }
+    probe.report (state, 1);
+  }
+  BENCHMARK (coreSunpos)->Name ("core/sunpos");
+
+  void coreSunRaDec (benchmark::State& state) {
+    const std::vector<double>& d = instants ();
+    std::size_t i = 0;
+    double ra, dec, r;
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      sun_RA_dec (d[i++ & (kQueryCount - 1)], &ra, &dec, &r);
+      benchmark::DoNotOptimize (ra);
+      benchmark::DoNotOptimize (dec);
+      benchmark::DoNotOptimize (r);
+    }
+    probe.report (state, 1);
+  }
+  BENCHMARK (coreSunRaDec)->Name ("core/sun_RA_dec");
+
+  void coreGmst0 (benchmark::State& state) {
+    const std::vector<double>& d = instants ();
+    std::size_t i = 0;
+    const bench::CallProbe probe;
+    for (auto _ : state)
+      benchmark::DoNotOptimize (GMST0 (d[i++ & (kQueryCount - 1)]));
+    probe.report (state, 1);
+  }
+  BENCHMARK (coreGmst0)->Name ("core/GMST0");
+
+  // The class logs on construction, so one instance is shared by the wrapper benchmarks
+  dotname::Sunriset& library () {
+    static dotname::Sunriset instance;
+    return instance;
+  }
+
+  void wrapperGetSunriset (benchmark::State& state) {
+    dotname::Sunriset& lib = library ();
+    const std::vector<Query>& q = queries ();
+    std::size_t i = 0;
+    double rise, set;
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      const Query& at = q[i++ & (kQueryCount - 1)];
+      benchmark::DoNotOptimize (lib.getSunriset (at.year, at.month, at.day, at.lon, at.lat, rise, set));
+      benchmark::DoNotOptimize (rise);
+      benchmark::DoNotOptimize (set);
+    }
+    probe.report (state, 1);
+  }
+  BENCHMARK (wrapperGetSunriset)->Name ("wrapper/Sunriset::getSunriset");
+
+  // Repeated queries: every one of the 4096 is cached before the timing loop, and the
+  // threads share the cache
+  void cacheHit (benchmark::State& state) {
+    static dotname::ResultCache cache;
+    const std::vector<Query>& q = queries ();
+    for (const Query& at : q)
+      cache.get (at.year, at.month, at.day, at.lon, at.lat);
+    std::size_t i = static_cast<std::size_t> (state.thread_index ()) * 997;
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      const Query& at = q[i++ & (kQueryCount - 1)];
+      benchmark::DoNotOptimize (cache.get (at.year, at.month, at.day, at.lon, at.lat));
+    }
+    probe.report (state, 1);
+  }
+  BENCHMARK (cacheHit)->Name ("cache/ResultCache::get/hit")->Threads (1)->Threads (4);
+
+  // Every thread asks for the same 4 keys, all in a few shards: the case a per-shard lock
+  // serialized, and the one the lock-free hit path is for
+  void cacheHotKey (benchmark::State& state) {
+    static dotname::ResultCache cache;
+    const std::vector<Query>& q = queries ();
+    for (std::size_t k = 0; k < 4; ++k)
+      cache.get (q[k].year, q[k].month, q[k].day, q[k].lon, q[k].lat);
+    std::size_t i = 0;
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      const Query& at = q[i++ & 3];
+      benchmark::DoNotOptimize (cache.get (at.year, at.month, at.day, at.lon, at.lat));
+    }
+    probe.report (state, 1);
+  }
+  BENCHMARK (cacheHotKey)->Name ("cache/ResultCache::get/hotKey")->Threads (1)->Threads (4);
+
+  // Every query a miss that evicts: the compute plus the bookkeeping
+  void cacheMiss (benchmark::State& state) {
+    dotname::ResultCache::Config config;
+    config.capacity = kQueryCount / 4;
+    dotname::ResultCache cache (config);
+    const std::vector<Query>& q = queries ();
+    std::size_t i = 0;
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      const Query& at = q[i++ & (kQueryCount - 1)];
+      benchmark::DoNotOptimize (cache.get (at.year, at.month, at.day, at.lon, at.lat));
+    }
+    probe.report (state, 1);
+  }
+  BENCHMARK (cacheMiss)->Name ("cache/ResultCache::get/miss");
+
+  void wrapperDoubleTo24Time (benchmark::State& state) {
+    dotname::Sunriset& lib = library ();
+    std::vector<double> times (kQueryCount);
+    for (std::size_t k = 0; k < kQueryCount; ++k)
+      times[k] = 24.0 * static_cast<double> (k) / kQueryCount;
+    std::size_t i = 0;
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      std::string text = lib.doubleTo24Time (times[i++ & (kQueryCount - 1)]);
+      benchmark::DoNotOptimize (text.data ());
+    }
+    probe.report (state, 1);
+  }
+  BENCHMARK (wrapperDoubleTo24Time)->Name ("wrapper/Sunriset::doubleTo24Time");
+
+} // namespace
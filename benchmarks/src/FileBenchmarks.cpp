@@ -0,0 +1,64 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+// Whole-file scan through Utils::FSManager::read (stream copy into a string) against
+// the MappedFile view, on a 64 MiB temporary file that stays in the page cache
+
+#include "BenchSupport.hpp"
+
+#include <Utils/Utils.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <string_view>
+
+namespace {
+
+  constexpr std::size_t kFileBytes = std::size_t{ 64 } << 20;
+
+  const std::filesystem::path& scratchFile () {
+    static const std::filesystem::path path = [] {
+      const std::filesystem::path p
+          = std::filesystem::temp_directory_path () / "SunrisetBenchmarks.scan";
+      std::ofstream out (p, std::ios::binary | std::ios::trunc);
+      std::string line = "50.0755,14.4378\n";
+      for (std::size_t written = 0; written < kFileBytes; written += line.size ())
+        out << line;
+      return p;
+    }();
+    return path;
+  }
+
+  // Consumes every byte so neither variant can skip the pages
+  std::uint64_t checksum (std::string_view bytes) {
+    return std::accumulate (
+        bytes.begin (), bytes.end (), std::uint64_t{ 0 },
+        [] (std::uint64_t sum, char c) { return sum + static_cast<unsigned char> (c); });
+  }
+
+  void readCopy (benchmark::State& state) {
+    const std::filesystem::path& path = scratchFile ();
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      const std::string text = Utils::FSManager::read (path.string ());
+      benchmark::DoNotOptimize (checksum (text));
+    }
+    probe.report (state, 1);
+    state.SetBytesProcessed (static_cast<std::int64_t> (state.iterations () * kFileBytes));
+  }
+  BENCHMARK (readCopy)->Name ("file/scan64M/FSManager::read")->Unit (benchmark::kMillisecond);
+
+  void mappedView (benchmark::State& state) {
+    const std::filesystem::path& path = scratchFile ();
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      const Utils::FSManager::MappedFile file (path);
+      benchmark::DoNotOptimize (checksum (file.view ()));
+    }
+    probe.report (state, 1);
+    state.SetBytesProcessed (static_cast<std::int64_t> (state.iterations () * kFileBytes));
+  }
+  BENCHMARK (mappedView)->Name ("file/scan64M/MappedFile")->Unit (benchmark::kMillisecond);
+
+} // namespace
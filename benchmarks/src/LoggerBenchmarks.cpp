@@ -0,0 +1,72 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+// Cost of LOG_* statements the runtime level filters out (allocs/call must stay 0) and
+// of enabled LOG_*_FMT statements going to the binary sink
+
+#include "BenchSupport.hpp"
+
+#include <Logger/Logger.hpp>
+
+#include <filesystem>
+
+namespace {
+
+  // Raises the threshold for the duration of one benchmark
+  class QuietLogger {
+  public:
+    QuietLogger () : previous_ (LOG.getLevel ()) {
+      LOG.setLevel (Logger::Level::LOG_CRITICAL);
+    }
+    ~QuietLogger () {
+      LOG.setLevel (previous_);
+    }
+
+  private:
+    Logger::Level previous_;
+  };
+
+  void disabledStream (benchmark::State& state) {
+    const QuietLogger quiet;
+    double value = 6.25;
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      LOG_I_STREAM << "Sunrise: " << value << " h" << std::endl;
+      benchmark::DoNotOptimize (value);
+    }
+    probe.report (state, 1);
+  }
+  BENCHMARK (disabledStream)->Name ("logger/disabled/LOG_I_STREAM");
+
+  void disabledFmt (benchmark::State& state) {
+    const QuietLogger quiet;
+    double value = 6.25;
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      LOG_I_FMT ("Sunrise: {:.3f} h", value);
+      benchmark::DoNotOptimize (value);
+    }
+    probe.report (state, 1);
+  }
+  BENCHMARK (disabledFmt)->Name ("logger/disabled/LOG_I_FMT");
+
+  void binaryFmt (benchmark::State& state) {
+    const std::filesystem::path path
+        = std::filesystem::temp_directory_path () / "SunrisetBenchmarks.blog";
+    if (!LOG.enableBinaryLogging (path.string ())) {
+      state.SkipWithError ("cannot open the binary log");
+      return;
+    }
+    int i = 0;
+    double value = 6.25;
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      LOG_I_FMT ("query {} sunrise {:.3f} h", ++i, value);
+    }
+    probe.report (state, 1);
+    LOG.disableBinaryLogging ();
+    std::filesystem::remove (path);
+  }
+  BENCHMARK (binaryFmt)->Name ("logger/binary/LOG_I_FMT");
+
+} // namespace
@@ -0,0 +1,22 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include "BenchSupport.hpp"
+
+#include <Sunriset/Batch.hpp>
+
+int main (int argc, char** argv) {
+  benchmark::AddCustomContext ("simd", dotname::simdLevelName (dotname::simdLevel ()));
+#if defined(SUNRISET_BENCH_HAS_TSC)
+  benchmark::AddCustomContext ("cycles", "TSC reference cycles");
+#else
+  benchmark::AddCustomContext ("cycles", "not available");
+#endif
+
+  benchmark::Initialize (&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments (argc, argv))
+    return 1;
+  benchmark::RunSpecifiedBenchmarks ();
+  benchmark::Shutdown ();
+  return 0;
+}
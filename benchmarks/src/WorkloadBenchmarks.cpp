@@ -0,0 +1,565 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+// Realistic workloads, each run through the exact C path and the library's fast paths
+// so a change to any of them is measured against the same baseline. One "call" is one
+// rise/set (or one SolarDay) result.
+
+#include "BenchSupport.hpp"
+
+#include <Sunriset/Batch.hpp>
+#include <Sunriset/BatchExecutor.hpp>
+#include <Sunriset/ChebyshevEphemeris.hpp>
+#include <Sunriset/EphemerisTable.hpp>
+#include <Sunriset/LocationSet.hpp>
+#include <Sunriset/SolarDay.hpp>
+#include <Sunriset/SolarGrid.hpp>
+#include <Sunriset/SolarKernels.hpp>
+#include <Sunriset/SolarPacking.hpp>
+#include <Sunriset/SolarPosition.hpp>
+#include <Sunriset/SolarTable.hpp>
+#include <Sunriset/Sunriset.hpp>
+#include <Sunriset/Terminator.hpp>
+
+#include <filesystem>
+
+namespace {
+
+  using dotname::SimdLevel;
+  using dotname::SolarEvent;
+
+  // ---------------------------------------------------------------------------------
+  // One site over 100 years (2000-01-01 + 36525 days)
+  // ---------------------------------------------------------------------------------
+
+  constexpr std::size_t kCenturyDays = 36525;
+  constexpr double kSiteLon = 14.42;
+  constexpr double kSiteLat = 50.08;
+
+  struct CenturyOutput {
+    std::vector<double> rise = std::vector<double> (kCenturyDays);
+    std::vector<double> set = std::vector<double> (kCenturyDays);
+    std::vector<std::int8_t> status = std::vector<std::int8_t> (kCenturyDays);
+  };
+
+  void centuryC (benchmark::State& state) {
+    CenturyOutput out;
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      // days_since_2000_Jan_0 is linear in the day of month, so day 1 + k walks the dates
+      for (std::size_t k = 0; k < kCenturyDays; ++k)
+        out.status[k] = static_cast<std::int8_t> (sun_rise_set (
+            2000, 1, 1 + static_cast<int> (k), kSiteLon, kSiteLat, &out.rise[k], &out.set[k]));
+      benchmark::ClobberMemory ();
+    }
+    probe.report (state, kCenturyDays);
+  }
+  BENCHMARK (centuryC)->Name ("century/sun_rise_set")->Unit (benchmark::kMillisecond);
+
+  void centuryRange (benchmark::State& state) {
+    CenturyOutput out;
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      dotname::sunrisetRange (2000, 1, 1, kCenturyDays, kSiteLon, kSiteLat, out.rise.data (),
+                              out.set.data (), out.status.data ());
+      benchmark::ClobberMemory ();
+    }
+    probe.report (state, kCenturyDays);
+  }
+  BENCHMARK (centuryRange)->Name ("century/sunrisetRange")->Unit (benchmark::kMillisecond);
+
+  void centuryRangeVectorized (benchmark::State& state) {
+    CenturyOutput out;
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      dotname::sunrisetRangeVectorized (2000, 1, 1, kCenturyDays, kSiteLon, kSiteLat,
+                                        out.rise.data (), out.set.data (), out.status.data (),
+                                        SolarEvent::SunriseSunset,
+                                        static_cast<SimdLevel> (state.range (0)));
+      benchmark::ClobberMemory ();
+    }
+    probe.report (state, kCenturyDays);
+  }
+  BENCHMARK (centuryRangeVectorized)
+      ->Name ("century/sunrisetRangeVectorized")
+      ->ArgName ("level")
+      ->DenseRange (static_cast<int> (SimdLevel::Scalar), static_cast<int> (SimdLevel::Avx512))
+      ->Unit (benchmark::kMillisecond);
+
+  void centuryRangeFloat (benchmark::State& state) {
+    std::vector<float> rise (kCenturyDays), set (kCenturyDays);
+    std::vector<std::int8_t> status (kCenturyDays);
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      dotname::sunrisetRangeFloat (2000, 1, 1, kCenturyDays, static_cast<float> (kSiteLon),
+                                   static_cast<float> (kSiteLat), rise.data (), set.data (),
+                                   status.data (), SolarEvent::SunriseSunset,
+                                   static_cast<SimdLevel> (state.range (0)));
+      benchmark::ClobberMemory ();
+    }
+    probe.report (state, kCenturyDays);
+  }
+  BENCHMARK (centuryRangeFloat)
+      ->Name ("century/sunrisetRangeFloat")
+      ->ArgName ("level")
+      ->DenseRange (static_cast<int> (SimdLevel::Scalar), static_cast<int> (SimdLevel::Avx512))
+      ->Unit (benchmark::kMillisecond);
+
+  void centuryTemplateKernel (benchmark::State& state) {
+    CenturyOutput out;
+    const long first = dotname::core::daysSince2000Jan0 (2000, 1, 1);
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      for (std::size_t k = 0; k < kCenturyDays; ++k) {
+        const dotname::core::RiseSet rs = dotname::sunrisetFor<SolarEvent::SunriseSunset> (
+            first + static_cast<long> (k), kSiteLon, kSiteLat);
+        out.rise[k] = rs.rise;
+        out.set[k] = rs.set;
+        out.status[k] = static_cast<std::int8_t> (rs.rc);
+      }
+      benchmark::ClobberMemory ();
+    }
+    probe.report (state, kCenturyDays);
+  }
+  BENCHMARK (centuryTemplateKernel)
+      ->Name ("century/sunrisetFor<SunriseSunset>")
+      ->Unit (benchmark::kMillisecond);
+
+  void centurySolarDay (benchmark::State& state) {
+    std::vector<dotname::SolarDay> days (kCenturyDays);
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      dotname::solarDayRange (2000, 1, 1, kCenturyDays, kSiteLon, kSiteLat, days.data ());
+      benchmark::ClobberMemory ();
+    }
+    probe.report (state, kCenturyDays);
+  }
+  BENCHMARK (centurySolarDay)->Name ("century/solarDayRange")->Unit (benchmark::kMillisecond);
+
+  // The century decoded from its packed forms: minute-resolution delta-coded series and
+  // 4-byte PackedEventTimes. byteSize reports the memory each form holds.
+  const std::vector<dotname::SolarDay>& centuryDays () {
+    static const std::vector<dotname::SolarDay> days = [] {
+      std::vector<dotname::SolarDay> d (kCenturyDays);
+      dotname::solarDayRange (2000, 1, 1, kCenturyDays, kSiteLon, kSiteLat, d.data ());
+      return d;
+    }();
+    return days;
+  }
+
+  void centuryPackedSeries (benchmark::State& state) {
+    dotname::PackedSeries series;
+    series.encode (centuryDays ().data (), kCenturyDays, SolarEvent::SunriseSunset);
+    CenturyOutput out;
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      series.decode (0, kCenturyDays, out.rise.data (), out.set.data (), out.status.data ());
+      benchmark::ClobberMemory ();
+    }
+    probe.report (state, kCenturyDays);
+    state.counters["byteSize"] = static_cast<double> (series.byteSize ());
+  }
+  BENCHMARK (centuryPackedSeries)
+      ->Name ("century/PackedSeries::decode")
+      ->Unit (benchmark::kMillisecond);
+
+  void centuryUnpackBatch (benchmark::State& state) {
+    std::vector<dotname::PackedEventTimes> packed (kCenturyDays);
+    for (std::size_t k = 0; k < kCenturyDays; ++k)
+      packed[k] = dotname::pack (centuryDays ()[k][SolarEvent::SunriseSunset]);
+    CenturyOutput out;
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      dotname::unpackBatch (packed.data (), kCenturyDays, out.rise.data (), out.set.data (),
+                            out.status.data ());
+      benchmark::ClobberMemory ();
+    }
+    probe.report (state, kCenturyDays);
+    state.counters["byteSize"] = static_cast<double> (packed.size () * sizeof (packed[0]));
+  }
+  BENCHMARK (centuryUnpackBatch)->Name ("century/unpackBatch")->Unit (benchmark::kMillisecond);
+
+  // ---------------------------------------------------------------------------------
+  // Solar tracker: elevation/azimuth of one panel every 5 s over a day. One "call" is one
+  // sample.
+  // ---------------------------------------------------------------------------------
+
+  constexpr std::size_t kTrackerSamples = 86400 / 5;
+
+  void trackerSeries (benchmark::State& state) {
+    const dotname::SolarPositionSeries series (2025, 6, 21, 0.0, 5.0, kTrackerSamples);
+    std::vector<double> elevation (kTrackerSamples), azimuth (kTrackerSamples);
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      series.evaluate (kSiteLat, kSiteLon, elevation.data (), azimuth.data ());
+      benchmark::ClobberMemory ();
+    }
+    probe.report (state, kTrackerSamples);
+  }
+  BENCHMARK (trackerSeries)
+      ->Name ("tracker5s/SolarPositionSeries::evaluate")
+      ->Unit (benchmark::kMillisecond);
+
+  void trackerExact (benchmark::State& state) {
+    const dotname::SolarPositionSeries series (2025, 6, 21, 0.0, 5.0, kTrackerSamples);
+    std::vector<double> elevation (kTrackerSamples), azimuth (kTrackerSamples);
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      for (std::size_t k = 0; k < kTrackerSamples; ++k) {
+        const dotname::SubsolarPoint sun = dotname::subsolarPoint (series.instant (k));
+        const dotname::HorizontalPosition p = dotname::solarPosition (sun, kSiteLat, kSiteLon);
+        elevation[k] = p.elevation;
+        azimuth[k] = p.azimuth;
+      }
+      benchmark::ClobberMemory ();
+    }
+    probe.report (state, kTrackerSamples);
+  }
+  BENCHMARK (trackerExact)->Name ("tracker5s/solarPosition")->Unit (benchmark::kMillisecond);
+
+  // ---------------------------------------------------------------------------------
+  // 1M observers spread over the globe on one date, and the same cell count as a raster
+  // ---------------------------------------------------------------------------------
+
+  constexpr std::size_t kSweepCount = 1 << 20;
+
+  const bench::Observers& sweepObservers () {
+    static const bench::Observers observers = bench::globalObservers (kSweepCount);
+    return observers;
+  }
+
+  const bench::Observers& polarStress () {
+    static const bench::Observers observers = bench::polarObservers (kSweepCount / 4);
+    return observers;
+  }
+
+  struct SweepOutput {
+    explicit SweepOutput (std::size_t count) : rise (count), set (count), status (count) {}
+    std::vector<double> rise, set;
+    std::vector<std::int8_t> status;
+  };
+
+  template <class Set>
+  void sweepBatch (benchmark::State& state, Set observers, int month) {
+    const bench::Observers& obs = observers ();
+    const std::size_t n = obs.lon.size ();
+    SweepOutput out (n);
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      dotname::sunrisetBatch (2025, month, 20, obs.lon.data (), obs.lat.data (), n,
+                              out.rise.data (), out.set.data (), out.status.data ());
+      benchmark::ClobberMemory ();
+    }
+    probe.report (state, n);
+  }
+
+  template <class Set>
+  void sweepBatchVectorized (benchmark::State& state, Set observers, int month,
+                             SimdLevel level) {
+    const bench::Observers& obs = observers ();
+    const std::size_t n = obs.lon.size ();
+    SweepOutput out (n);
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      dotname::sunrisetBatchVectorized (2025, month, 20, obs.lon.data (), obs.lat.data (), n,
+                                        out.rise.data (), out.set.data (), out.status.data (),
+                                        SolarEvent::SunriseSunset, level);
+      benchmark::ClobberMemory ();
+    }
+    probe.report (state, n);
+  }
+
+  template <class Set>
+  void sweepBatchFloat (benchmark::State& state, Set observers, int month, SimdLevel level) {
+    const bench::Observers& obs = observers ();
+    const std::size_t n = obs.lon.size ();
+    const std::vector<float> lon (obs.lon.begin (), obs.lon.end ());
+    const std::vector<float> lat (obs.lat.begin (), obs.lat.end ());
+    std::vector<float> rise (n), set (n);
+    std::vector<std::int8_t> status (n);
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      dotname::sunrisetBatchFloat (2025, month, 20, lon.data (), lat.data (), n, rise.data (),
+                                   set.data (), status.data (), SolarEvent::SunriseSunset,
+                                   level);
+      benchmark::ClobberMemory ();
+    }
+    probe.report (state, n);
+  }
+
+  void globalBatch (benchmark::State& state) {
+    sweepBatch (state, sweepObservers, 6);
+  }
+  BENCHMARK (globalBatch)->Name ("global1M/sunrisetBatch")->Unit (benchmark::kMillisecond);
+
+  void globalBatchVectorized (benchmark::State& state) {
+    sweepBatchVectorized (state, sweepObservers, 6, static_cast<SimdLevel> (state.range (0)));
+  }
+  BENCHMARK (globalBatchVectorized)
+      ->Name ("global1M/sunrisetBatchVectorized")
+      ->ArgName ("level")
+      ->DenseRange (static_cast<int> (SimdLevel::Scalar), static_cast<int> (SimdLevel::Avx512))
+      ->Unit (benchmark::kMillisecond);
+
+  void globalBatchFloat (benchmark::State& state) {
+    sweepBatchFloat (state, sweepObservers, 6, static_cast<SimdLevel> (state.range (0)));
+  }
+  BENCHMARK (globalBatchFloat)
+      ->Name ("global1M/sunrisetBatchFloat")
+      ->ArgName ("level")
+      ->DenseRange (static_cast<int> (SimdLevel::Scalar), static_cast<int> (SimdLevel::Avx512))
+      ->Unit (benchmark::kMillisecond);
+
+  // The same observers from a LocationSet, with sind/cosd (lat) and lon / 360 precomputed
+  const dotname::LocationSet& sweepLocations () {
+    static const dotname::LocationSet sites = [] {
+      const bench::Observers& obs = sweepObservers ();
+      dotname::LocationSet set;
+      set.reserve (obs.lon.size ());
+      for (std::size_t i = 0; i < obs.lon.size (); ++i)
+        set.add (i, obs.lat[i], obs.lon[i]);
+      return set;
+    }();
+    return sites;
+  }
+
+  void globalLocationSet (benchmark::State& state) {
+    const dotname::LocationSet& sites = sweepLocations ();
+    const auto level = static_cast<SimdLevel> (state.range (0));
+    SweepOutput out (sites.size ());
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      if (level == SimdLevel::Scalar)
+        dotname::sunrisetBatch (2025, 6, 20, sites, out.rise.data (), out.set.data (),
+                                out.status.data ());
+      else
+        dotname::sunrisetBatchVectorized (2025, 6, 20, sites, out.rise.data (), out.set.data (),
+                                          out.status.data (), SolarEvent::SunriseSunset, level);
+      benchmark::ClobberMemory ();
+    }
+    probe.report (state, sites.size ());
+  }
+  BENCHMARK (globalLocationSet)
+      ->Name ("global1M/sunrisetBatchVectorized(LocationSet)")
+      ->ArgName ("level")
+      ->DenseRange (static_cast<int> (SimdLevel::Scalar), static_cast<int> (SimdLevel::Avx512))
+      ->Unit (benchmark::kMillisecond);
+
+  // Which of the 1M observers are in daylight at 03:00 UT on the June solstice; the
+  // latitude bands of the polar day and night are taken or skipped whole
+  void globalTerminator (benchmark::State& state) {
+    static const dotname::TerminatorIndex index = [] {
+      dotname::TerminatorIndex built;
+      built.build (sweepLocations ());
+      return built;
+    }();
+    const dotname::SubsolarPoint sun = dotname::subsolarPoint (2025, 6, 21, 3.0);
+    std::vector<std::uint64_t> bitmap;
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      index.selectBitmap (sun, dotname::Illumination::Day, bitmap,
+                          static_cast<SimdLevel> (state.range (0)));
+      benchmark::ClobberMemory ();
+    }
+    probe.report (state, index.siteCount ());
+  }
+  BENCHMARK (globalTerminator)
+      ->Name ("global1M/TerminatorIndex::selectBitmap")
+      ->ArgName ("level")
+      ->DenseRange (static_cast<int> (SimdLevel::Scalar), static_cast<int> (SimdLevel::Avx512))
+      ->Unit (benchmark::kMillisecond);
+
+  void globalEphemerisTable (benchmark::State& state) {
+    const bench::Observers& obs = sweepObservers ();
+    SweepOutput out (kSweepCount);
+    dotname::EphemerisTable table (static_cast<int> (state.range (0)));
+    // Build the block of the date outside the timing
+    table.sunrisetBatch (2025, 6, 20, obs.lon.data (), obs.lat.data (), 1, out.rise.data (),
+                         out.set.data (), out.status.data ());
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      table.sunrisetBatch (2025, 6, 20, obs.lon.data (), obs.lat.data (), kSweepCount,
+                           out.rise.data (), out.set.data (), out.status.data ());
+      benchmark::ClobberMemory ();
+    }
+    probe.report (state, kSweepCount);
+  }
+  BENCHMARK (globalEphemerisTable)
+      ->Name ("global1M/EphemerisTable::sunrisetBatch")
+      ->ArgName ("samplesPerDay")
+      ->Arg (1)
+      ->Arg (4)
+      ->Unit (benchmark::kMillisecond);
+
+  void globalChebyshev (benchmark::State& state) {
+    const bench::Observers& obs = sweepObservers ();
+    SweepOutput out (kSweepCount);
+    static const dotname::ChebyshevEphemeris ephemeris;
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      ephemeris.sunrisetBatch (2025, 6, 20, obs.lon.data (), obs.lat.data (), kSweepCount,
+                               out.rise.data (), out.set.data (), out.status.data ());
+      benchmark::ClobberMemory ();
+    }
+    probe.report (state, kSweepCount);
+    state.counters["byteSize"] = static_cast<double> (ephemeris.byteSize ());
+  }
+  BENCHMARK (globalChebyshev)
+      ->Name ("global1M/ChebyshevEphemeris::sunrisetBatch")
+      ->Unit (benchmark::kMillisecond);
+
+  void globalExecutor (benchmark::State& state) {
+    const bench::Observers& obs = sweepObservers ();
+    SweepOutput out (kSweepCount);
+    dotname::BatchExecutor executor;
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      executor.sunriset (2025, 6, 20, 1, obs.lon.data (), obs.lat.data (), kSweepCount,
+                         out.rise.data (), out.set.data (), out.status.data (),
+                         SolarEvent::SunriseSunset, static_cast<SimdLevel> (state.range (0)));
+      benchmark::ClobberMemory ();
+    }
+    probe.report (state, kSweepCount);
+    state.counters["threads"] = executor.threadCount ();
+  }
+  BENCHMARK (globalExecutor)
+      ->Name ("global1M/BatchExecutor::sunriset")
+      ->ArgName ("level")
+      ->Arg (static_cast<int> (SimdLevel::Scalar))
+      ->Arg (static_cast<int> (SimdLevel::Auto))
+      ->UseRealTime ()
+      ->Unit (benchmark::kMillisecond);
+
+  void globalGrid (benchmark::State& state) {
+    // 1024 x 1024 cells over the whole map, the raster counterpart of the 1M sweep
+    const dotname::GridSpec grid{ -89.9, 179.8 / 1023, 1024, -180.0, 360.0 / 1024, 1024 };
+    const std::size_t cells = grid.nLat * grid.nLon;
+    std::vector<double> rise (cells), set (cells), length (cells);
+    std::vector<std::int8_t> status (cells);
+    const dotname::GridOptions options;
+    const bench::CallProbe probe;
+    for (auto _ : state) {
+      dotname::sunrisetGrid (2025, 6, 20, grid, options, rise.data (), set.data (),
+                             length.data (), status.data ());
+      benchmark::ClobberMemory ();
+    }
+    probe.report (state, cells);
+  }
+  BENCHMARK (globalGrid)->Name ("global1M/sunrisetGrid")->Unit (benchmark::kMillisecond);
+
+  // ---------------------------------------------------------------------------------
+  // Polar stress: 256k observers at |lat| >= 60, run at an equinox (month 3, the
+  // terminator crosses the poles and cost is near +-1 everywhere) and at a solstice
+  // (month 6, polar day and night)
+  // ---------------------------------------------------------------------------------
+
+  void polarBatch (benchmark::State& state) {
+    sweepBatch (state, polarStress, static_cast<int> (state.range (0)));
+  }
+  BENCHMARK (polarBatch)
+      ->Name ("polar256k/sunrisetBatch")
+      ->ArgName ("month")
+      ->Arg (3)
+      ->Arg (6)
+      ->Unit (benchmark::kMillisecond);
+
+  void polarBatchVectorized (benchmark::State& state) {
+    sweepBatchVectorized (state, polarStress, static_cast<int> (state.range (0)), SimdLevel::Auto);
+  }
+  BENCHMARK (polarBatchVectorized)
+      ->Name ("polar256k/sunrisetBatchVectorized")
+      ->ArgName ("month")
+      ->Arg (3)
+      ->Arg (6)
+      ->Unit (benchmark::kMillisecond);
+
+  void polarBatchFloat (benchmark::State& state) {
+    sweepBatchFloat (state, polarStress, static_cast<int> (state.range (0)), SimdLevel::Auto);
+  }
+  BENCHMARK (polarBatchFloat)
+      ->Name ("polar256k/sunrisetBatchFloat")
+      ->ArgName ("month")
+      ->Arg (3)
+      ->Arg (6)
+      ->Unit (benchmark::kMillisecond);
+
+  // ---------------------------------------------------------------------------------
+  // Precomputed table: random (site id, day) lookups in a 1024-site year against
+  // computing the same rise/set on the spot
+  // ---------------------------------------------------------------------------------
+
+  constexpr std::size_t kTableSites = 1024;
+  constexpr std::size_t kTableDays = 365;
+
+  struct TableQuery {
+    std::uint64_t id;
+    int day; // day of month counted from 2025-01-01, days_since_2000_Jan_0 is linear in it
+    double lon, lat;
+  };
+
+  struct TableFixture {
+    dotname::SolarTable table;
+    std::vector<TableQuery> queries;
+
+    TableFixture () {
+      const bench::Observers obs = bench::globalObservers (kTableSites);
+      std::vector<dotname::SolarTable::Site> sites (kTableSites);
+      for (std::size_t i = 0; i < kTableSites; ++i)
+        sites[i] = { 1000003u * (i + 1), obs.lat[i], obs.lon[i] };
+
+      const std::filesystem::path path
+          = std::filesystem::temp_directory_path () / "SunrisetBenchmarks.srt";
+      dotname::SolarTable::generate (path, sites, 2025, 1, 1, kTableDays);
+      table.open (path);
+      std::filesystem::remove (path); // the mapping stays valid
+
+      std::mt19937 rng (4);
+      std::uniform_int_distribution<std::size_t> site (0, kTableSites - 1);
+      std::uniform_int_distribution<int> day (0, static_cast<int> (kTableDays) - 1);
+      queries.resize (bench::kQueryCount);
+      for (TableQuery& q : queries) {
+        const std::size_t s = site (rng);
+        q = { sites[s].id, 1 + day (rng), sites[s].lon, sites[s].lat };
+      }
+    }
+  };
+
+  const TableFixture& tableFixture () {
+    static const TableFixture fixture;
+    return fixture;
+  }
+
+  void tableLookup (benchmark::State& state) {
+    const TableFixture& fixture = tableFixture ();
+    if (!fixture.table.isOpen ()) {
+      state.SkipWithError ("cannot generate the table");
+      return;
+    }
+    const bench::CallProbe probe;
+    std::size_t k = 0;
+    for (auto _ : state) {
+      const TableQuery& q = fixture.queries[k++ & (bench::kQueryCount - 1)];
+      dotname::SolarEventTimes times;
+      fixture.table.lookup (q.id, 2025, 1, q.day, SolarEvent::SunriseSunset, times);
+      benchmark::DoNotOptimize (times);
+    }
+    probe.report (state, 1);
+  }
+  BENCHMARK (tableLookup)->Name ("table1024x365/SolarTable::lookup");
+
+  void tableCompute (benchmark::State& state) {
+    const TableFixture& fixture = tableFixture ();
+    const bench::CallProbe probe;
+    std::size_t k = 0;
+    for (auto _ : state) {
+      const TableQuery& q = fixture.queries[k++ & (bench::kQueryCount - 1)];
+      double rise, set;
+      benchmark::DoNotOptimize (sun_rise_set (2025, 1, q.day, q.lon, q.lat, &rise, &set));
+      benchmark::DoNotOptimize (rise);
+      benchmark::DoNotOptimize (set);
+    }
+    probe.report (state, 1);
+  }
+  BENCHMARK (tableCompute)->Name ("table1024x365/sun_rise_set");
+
+} // namespace
@@ -0,0 +1,83 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __BATCH_HPP
+#define __BATCH_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <Sunriset/SolarTypes.hpp>
+
+namespace dotname {
+
+  // Structure-of-arrays rise/set for many observers on one calendar date.
+  // lon/lat are read from contiguous arrays of `count` elements, rise/set are written in
+  // hours UT exactly as __sunriset__ would, and status receives its return code per
+  // element (see SolarStatus). status may be nullptr when the caller does not need it.
+  void sunrisetBatch (int year, int month, int day, const double* lon, const double* lat,
+                      std::size_t count, double* rise, double* set, std::int8_t* status,
+                      SolarEvent event = SolarEvent::SunriseSunset);
+
+  // Rise/set for one observer on `dayCount` consecutive days starting at year-month-day,
+  // written contiguously per day. The calendar is resolved once and the day number is
+  // then stepped, so results are identical to calling __sunriset__ for every date.
+  void sunrisetRange (int year, int month, int day, std::size_t dayCount, double lon, double lat,
+                      double* rise, double* set, std::int8_t* status,
+                      SolarEvent event = SolarEvent::SunriseSunset);
+
+  // Instruction sets of the vectorized kernel, ordered by width
+  enum class SimdLevel : std::uint8_t { Auto, Scalar, Sse2, Avx2, Avx512 };
+
+  // Widest level supported by both this build and the running CPU (detected once)
+  SimdLevel simdLevel ();
+  const char* simdLevelName (SimdLevel level);
+
+  // Same contract as sunrisetBatch, evaluated 2/4/8 observers at a time with vector
+  // trigonometry (SSE2/AVX2/AVX-512, picked at runtime; levels above simdLevel() are
+  // clamped, Scalar falls back to sunrisetBatch).
+  // Tolerance against __sunriset__ over 1801-2099, all latitudes and longitudes:
+  // rise/set differ by less than 2e-9 hours (under 10 microseconds), up to ~4 ms within
+  // 0.01 degrees of the latitude where the event stops occurring. The status can only
+  // differ when cost lies within ~1e-15 of +-1, i.e. exactly at the polar cutoffs.
+  void sunrisetBatchVectorized (int year, int month, int day, const double* lon,
+                                const double* lat, std::size_t count, double* rise, double* set,
+                                std::int8_t* status, SolarEvent event = SolarEvent::SunriseSunset,
+                                SimdLevel level = SimdLevel::Auto);
+
+  // sunrisetRange with the days spread over the vector lanes, same tolerance as above
+  void sunrisetRangeVectorized (int year, int month, int day, std::size_t dayCount, double lon,
+                                double lat, double* rise, double* set, std::int8_t* status,
+                                SolarEvent event = SolarEvent::SunriseSunset,
+                                SimdLevel level = SimdLevel::Auto);
+
+  // Single-precision mode of the two functions above, same layout and status codes.
+  // The day number is resolved in double once per chunk of lanes and only offsets of less
+  // than one chunk are carried in float; the rest of the chain runs in float with twice
+  // the lanes of the double kernel (4/8/16) and half the memory traffic, ~2.2-2.9x the
+  // throughput of sunrisetBatchVectorized at the same level. SimdLevel::Scalar runs the
+  // same arithmetic one lane at a time (consistent results, no speedup).
+  // Against the double __sunriset__ (SunrisetAccuracy, 1801-2099, 2 x 30 degree lattice,
+  // all four events): rise/set within 0.05 s for sunrise and civil twilight up to
+  // |lat| 60, within 16 s up to |lat| 88; status differs for a handful of lattice points
+  // next to the poles. Closer than ~0.01 degrees to the latitude where the event stops
+  // occurring the float cost is too coarse: times can be off by hours and the status
+  // differs for ~7% of such observers. A time within rounding of the 0/24 h wrap of the
+  // meridian transit may come out 24 h apart from the double one.
+  void sunrisetBatchFloat (int year, int month, int day, const float* lon, const float* lat,
+                           std::size_t count, float* rise, float* set, std::int8_t* status,
+                           SolarEvent event = SolarEvent::SunriseSunset,
+                           SimdLevel level = SimdLevel::Auto);
+
+  void sunrisetRangeFloat (int year, int month, int day, std::size_t dayCount, float lon,
+                           float lat, float* rise, float* set, std::int8_t* status,
+                           SolarEvent event = SolarEvent::SunriseSunset,
+                           SimdLevel level = SimdLevel::Auto);
+
+  // One observer in single precision, returns the status
+  int sunrisetFloat (int year, int month, int day, float lon, float lat, float& rise, float& set,
+                     SolarEvent event = SolarEvent::SunriseSunset);
+
+} // namespace dotname
+
+#endif // __BATCH_HPP
@@ -0,0 +1,104 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __BATCHEXECUTOR_HPP
+#define __BATCHEXECUTOR_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <Sunriset/Batch.hpp>
+#include <Sunriset/SolarGrid.hpp>
+#include <Sunriset/SolarTypes.hpp>
+
+namespace dotname {
+
+  // Thread pool for location x date workloads that do not fit one core.
+  //
+  // A job is cut into tiles (up to 1024 observers x 16 days, so a tile's lon/lat stay in
+  // cache while its days are swept). Each thread starts on a contiguous share of the
+  // tiles; a thread that runs dry steals the upper half of another thread's remaining
+  // share. Tiles write disjoint slices of the output and no value depends on the tiling
+  // or on which thread computed it, so results are bit-identical for every thread count
+  // and to the single-threaded function each job is built on.
+  class BatchExecutor {
+  public:
+    // 0 uses std::thread::hardware_concurrency (); the calling thread is one of them
+    explicit BatchExecutor (unsigned threadCount = 0);
+    ~BatchExecutor ();
+
+    BatchExecutor (const BatchExecutor&) = delete;
+    BatchExecutor& operator= (const BatchExecutor&) = delete;
+
+    unsigned threadCount () const {
+      return threadCount_;
+    }
+
+    // Share ranges taken over by idle threads since construction
+    std::uint64_t stealCount () const {
+      return steals_.load (std::memory_order_relaxed);
+    }
+
+    // Runs task (tile) for every tile in [0, tileCount) and returns when all are done.
+    // Concurrent calls are serialized. If tasks throw, the remaining tiles still run and
+    // the first exception is rethrown here.
+    void parallelFor (std::size_t tileCount, const std::function<void (std::size_t)>& task);
+
+    // Rise/set for `count` observers on `dayCount` consecutive days starting at
+    // year-month-day, written day-major: element [dayIndex * count + observer].
+    // SimdLevel::Scalar runs the exact core (identical to __sunriset__, as sunrisetBatch);
+    // any other level runs the vectorized kernel with sunrisetBatchVectorized's tolerance.
+    void sunriset (int year, int month, int day, std::size_t dayCount, const double* lon,
+                   const double* lat, std::size_t count, double* rise, double* set,
+                   std::int8_t* status, SolarEvent event = SolarEvent::SunriseSunset,
+                   SimdLevel level = SimdLevel::Scalar);
+
+    // __daylen__ for the same layout; the event selects the altitude and limb flag the
+    // day_length / day_*_twilight_length macros use
+    void daylen (int year, int month, int day, std::size_t dayCount, const double* lon,
+                 const double* lat, std::size_t count, double* length,
+                 SolarEvent event = SolarEvent::SunriseSunset);
+
+    // sunrisetGrid with the column ephemeris and the rows spread over the pool
+    void sunrisetGrid (int year, int month, int day, const GridSpec& grid,
+                       const GridOptions& options, double* rise, double* set, double* dayLength,
+                       std::int8_t* status);
+
+  private:
+    struct Share;
+
+    void workerLoop (unsigned self);
+    void drain (unsigned self);
+    bool popLocal (unsigned self, std::size_t& tile);
+    bool steal (unsigned self, std::size_t& tile);
+    void run (std::size_t tile);
+
+    unsigned threadCount_;
+    std::unique_ptr<Share[]> shares_;
+    std::vector<std::thread> workers_;
+
+    std::mutex submitMutex_;
+    std::mutex stateMutex_;
+    std::condition_variable wakeCv_;
+    std::condition_variable doneCv_;
+    std::uint64_t generation_ = 0;
+    bool stop_ = false;
+
+    const std::function<void (std::size_t)>* task_ = nullptr;
+    std::atomic<std::size_t> pending_{ 0 };
+    std::atomic<std::uint64_t> steals_{ 0 };
+    std::mutex errorMutex_;
+    std::exception_ptr error_;
+  };
+
+} // namespace dotname
+
+#endif // __BATCHEXECUTOR_HPP
@@ -0,0 +1,109 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __CHEBYSHEVEPHEMERIS_HPP
+#define __CHEBYSHEVEPHEMERIS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <Sunriset/SolarCore.hpp>
+#include <Sunriset/SolarTypes.hpp>
+
+namespace dotname {
+
+  // Where the Sun's position comes from, see Sunriset::setEphemerisModel
+  enum class EphemerisModel : std::uint8_t {
+    Exact,    // sunpos / sun_RA_dec on every call
+    Chebyshev // ChebyshevEphemeris
+  };
+
+  // sun_RA_dec as piecewise polynomials over the supported 1801-2099 range.
+  //
+  // Over a few weeks the declination, the distance and the offset of the Sun's RA from
+  // the mean longitude in GMST0 (the equation of time, which is what __sunriset__'s
+  // tsouth depends on) are very smooth. The range is cut into segments of `segmentDays`;
+  // each quantity is interpolated at Chebyshev nodes of its segment, the series is cut
+  // to `degree` and converted to a power series in the segment's [-1, 1] coordinate, so
+  // at() is one Horner chain per quantity plus a sqrt for cos (dec), instead of sunpos's
+  // trig calls, sqrt and atan2. All segments are fitted by the constructor (~40k
+  // sun_RA_dec calls with the defaults, ~20 ms); they take 0.9 MB.
+  //
+  // errorBudget () is the truncation estimate, the sum of the coefficients past `degree`;
+  // rounding in the power series adds ~1e-13 to it. With the defaults (32 days, degree
+  // 10), measured against sun_RA_dec at 0.01 day steps over the whole range: sin (dec)
+  // within 2e-13, distance within 1e-14 AU, equation of time within 6e-11 degrees
+  // (1.4e-8 s of tsouth). Rise/set (SunrisetAccuracy, 1801-2099, all four events) stay
+  // within 3e-6 s of __sunriset__ with no status code changed. On one x86-64 core at ()
+  // takes ~35 ns against ~240 ns for sun_RA_dec, a rise/set ~95 ns against ~310 ns.
+  class ChebyshevEphemeris {
+  public:
+    struct Sample {
+      double sinDec;   // sine of the declination
+      double cosDec;   // cosine of the declination
+      double r;        // Solar distance, astronomical units
+      double eqOfTime; // RA - (GMST0 - 180), degrees, -180..180
+    };
+
+    // Largest truncation estimate over all segments
+    struct ErrorBudget {
+      double sinDec;
+      double r;        // astronomical units
+      double eqOfTime; // degrees
+      double tsouthSeconds;
+    };
+
+    explicit ChebyshevEphemeris (int segmentDays = 32, int degree = 10);
+
+    int segmentDays () const {
+      return segmentDays_;
+    }
+    int degree () const {
+      return degree_;
+    }
+    std::size_t segmentCount () const {
+      return segmentCount_;
+    }
+    std::size_t byteSize () const {
+      return coefficients_.size () * sizeof (double);
+    }
+    const ErrorBudget& errorBudget () const {
+      return budget_;
+    }
+
+    // Ephemeris at instant d (days since 2000 Jan 0.0); exact outside the fitted range
+    Sample at (double d) const;
+
+    // core::sunTransitAt with the fitted ephemeris
+    core::SunTransit transitAt (double d, double lon) const;
+
+    // __sunriset__ equivalent, days = days_since_2000_Jan_0 (y, m, d)
+    core::RiseSet sunriset (long days, double lon, double lat, double altit,
+                            bool upperLimb) const;
+
+    int sunriset (int year, int month, int day, double lon, double lat, double altit,
+                  int upperLimb, double& rise, double& set) const;
+
+    void sunrisetBatch (int year, int month, int day, const double* lon, const double* lat,
+                        std::size_t count, double* rise, double* set, std::int8_t* status,
+                        SolarEvent event = SolarEvent::SunriseSunset) const;
+
+  private:
+    static constexpr int kQuantities = 3; // sinDec, r, eqOfTime
+
+    void fitSegment (std::size_t index, const double* basis);
+
+    int segmentDays_;
+    int degree_;
+    double inverseSegment_;
+    std::size_t segmentCount_;
+    // Per segment degree + 1 power-series coefficients, highest first, each power holding
+    // kQuantities interleaved values
+    std::vector<double> coefficients_;
+    ErrorBudget budget_{};
+  };
+
+} // namespace dotname
+
+#endif // __CHEBYSHEVEPHEMERIS_HPP
@@ -0,0 +1,92 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __EPHEMERISTABLE_HPP
+#define __EPHEMERISTABLE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <Sunriset/SolarCore.hpp>
+#include <Sunriset/SolarTypes.hpp>
+
+namespace dotname {
+
+  // Tabulated sun_RA_dec over the supported 1801-2099 range.
+  //
+  // sun_RA_dec (d) only depends on the instant d, so instead of running the Kepler/trig
+  // chain for every observer the table samples it `samplesPerDay` times a day and
+  // interpolates with a 4-point (cubic) Lagrange polynomial. The samples hold RA
+  // (unwrapped), sin/cos of the declination and the distance; GMST0 is linear in d and is
+  // evaluated exactly. Blocks of 366 days are built lazily on first use or all at once by
+  // load(). Queries, including the lazy build, are safe from any number of threads; load()
+  // is not, see below.
+  //
+  // Accuracy against __sunriset__ (SunrisetAccuracy, 1801-2099, 2 x 30 degree lattice,
+  // all four events): rise/set within 0.1 s with one sample per day and within 0.4 ms
+  // with four, the worst cases near the polar cutoffs (0.3 ms / 1 us for sunrise up to
+  // |lat| 60); no status code differed on the lattice. Within 0.01 degrees of a cutoff
+  // latitude the interpolated declination flips the status of ~0.2% of observers with
+  // one sample per day. A one-sample-per-day table is 3.5 MB once fully built.
+  // Speed on one x86-64 core: ~105 ns per rise/set query against ~280 ns for the exact
+  // batch path.
+  class EphemerisTable {
+  public:
+    struct Sample {
+      double ra;     // Right Ascension, degrees, continuous across 360
+      double sinDec; // sine of the declination
+      double cosDec; // cosine of the declination
+      double r;      // Solar distance, astronomical units
+    };
+
+    explicit EphemerisTable (int samplesPerDay = 1);
+    ~EphemerisTable ();
+
+    EphemerisTable (const EphemerisTable&) = delete;
+    EphemerisTable& operator= (const EphemerisTable&) = delete;
+
+    int samplesPerDay () const {
+      return samplesPerDay_;
+    }
+
+    // Interpolated ephemeris at instant d (days since 2000 Jan 0.0)
+    Sample at (double d) const;
+
+    // __sunriset__ equivalent, days = days_since_2000_Jan_0 (y, m, d)
+    core::RiseSet sunriset (long days, double lon, double lat, double altit,
+                            bool upperLimb) const;
+
+    int sunriset (int year, int month, int day, double lon, double lat, double altit,
+                  int upperLimb, double& rise, double& set) const;
+
+    void sunrisetBatch (int year, int month, int day, const double* lon, const double* lat,
+                        std::size_t count, double* rise, double* set, std::int8_t* status,
+                        SolarEvent event = SolarEvent::SunriseSunset) const;
+
+    // Builds every block and writes them out; load() replaces the lazy build.
+    // load() frees the blocks built so far: call it before the table is shared, never
+    // while other threads may be querying it.
+    bool save (const std::filesystem::path& filePath) const;
+    bool load (const std::filesystem::path& filePath);
+
+  private:
+    struct Block;
+
+    const Block& block (std::size_t index) const;
+    std::unique_ptr<Block> buildBlock (std::size_t index) const;
+
+    int samplesPerDay_;
+    double step_;
+    mutable std::mutex buildMutex_;
+    mutable std::vector<std::atomic<const Block*>> blocks_;
+    mutable std::vector<std::unique_ptr<Block>> owned_;
+  };
+
+} // namespace dotname
+
+#endif // __EPHEMERISTABLE_HPP
@@ -0,0 +1,127 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __LOCATIONSET_HPP
+#define __LOCATIONSET_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <unordered_map>
+#include <vector>
+
+#include <Sunriset/Batch.hpp>
+#include <Sunriset/SolarTypes.hpp>
+
+namespace dotname {
+
+  // Registry of observers kept in the layout the batch kernels read.
+  //
+  // Besides id, lon and lat every site stores sind (lat), cosd (lat) and lon / 360, the
+  // terms __sunriset__ recomputes on every call although they never change. The arrays
+  // are structure-of-arrays, 64-byte aligned and indexed by slot; the batch functions
+  // below write their results to the same slots.
+  //
+  // remove () only marks a slot, so the slots of the other sites stay valid for results
+  // already computed; compact () closes the gaps, keeping the order of the remaining sites.
+  // A removed slot is still evaluated, with its last coordinates, until then.
+  class LocationSet {
+  public:
+    static constexpr std::size_t npos = ~std::size_t{ 0 };
+    static constexpr std::size_t kAlignment = 64;
+
+    // false when the id is already in the set
+    bool add (std::uint64_t id, double lat, double lon);
+    // Moves a site; false when the id is not in the set
+    bool update (std::uint64_t id, double lat, double lon);
+    bool remove (std::uint64_t id);
+    // Returns the number of slots freed; slot numbers change
+    std::size_t compact ();
+    void reserve (std::size_t count);
+    void clear ();
+
+    // Slots, including removed ones not compacted yet
+    std::size_t size () const {
+      return ids_.size ();
+    }
+    std::size_t liveCount () const {
+      return index_.size ();
+    }
+    std::size_t removedCount () const {
+      return size () - liveCount ();
+    }
+    bool isLive (std::size_t slot) const {
+      return live_[slot] != 0;
+    }
+    // Slot of an id, npos when it is not in the set
+    std::size_t find (std::uint64_t id) const;
+
+    const std::uint64_t* ids () const {
+      return ids_.data ();
+    }
+    const double* lon () const {
+      return lon_.data ();
+    }
+    const double* lat () const {
+      return lat_.data ();
+    }
+    const double* sinLat () const {
+      return sinLat_.data ();
+    }
+    const double* cosLat () const {
+      return cosLat_.data ();
+    }
+    const double* lonFraction () const {
+      return lonFraction_.data ();
+    }
+
+  private:
+    template <typename T> struct AlignedAllocator {
+      using value_type = T;
+
+      AlignedAllocator () = default;
+      template <typename U> AlignedAllocator (const AlignedAllocator<U>&) {}
+
+      T* allocate (std::size_t n) {
+        return static_cast<T*> (::operator new (n * sizeof (T), std::align_val_t{ kAlignment }));
+      }
+      void deallocate (T* p, std::size_t) {
+        ::operator delete (p, std::align_val_t{ kAlignment });
+      }
+      template <typename U> bool operator== (const AlignedAllocator<U>&) const {
+        return true;
+      }
+      template <typename U> bool operator!= (const AlignedAllocator<U>&) const {
+        return false;
+      }
+    };
+    template <typename T> using Column = std::vector<T, AlignedAllocator<T>>;
+
+    void assign (std::size_t slot, double lat, double lon);
+
+    Column<std::uint64_t> ids_;
+    Column<double> lon_;
+    Column<double> lat_;
+    Column<double> sinLat_;
+    Column<double> cosLat_;
+    Column<double> lonFraction_;
+    std::vector<std::uint8_t> live_;
+    std::unordered_map<std::uint64_t, std::size_t> index_; // live id -> slot
+  };
+
+  // sunrisetBatch over every slot of `sites`; rise, set and status (may be nullptr) hold
+  // sites.size () elements. Identical to __sunriset__, as sunrisetBatch is.
+  void sunrisetBatch (int year, int month, int day, const LocationSet& sites, double* rise,
+                      double* set, std::int8_t* status,
+                      SolarEvent event = SolarEvent::SunriseSunset);
+
+  // sunrisetBatchVectorized over every slot of `sites`, same tolerance; the vector kernel
+  // skips the sine and cosine of the latitude
+  void sunrisetBatchVectorized (int year, int month, int day, const LocationSet& sites,
+                                double* rise, double* set, std::int8_t* status,
+                                SolarEvent event = SolarEvent::SunriseSunset,
+                                SimdLevel level = SimdLevel::Auto);
+
+} // namespace dotname
+
+#endif // __LOCATIONSET_HPP
@@ -0,0 +1,98 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __RESULTCACHE_HPP
+#define __RESULTCACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <Sunriset/SolarDay.hpp>
+#include <Sunriset/SolarTypes.hpp>
+
+namespace dotname {
+
+  // Bounded, thread-safe memo of rise/set results for services that see the same places
+  // and dates over and over.
+  //
+  // Queries are snapped to a grid of `gridDegrees` in latitude and longitude, and a miss
+  // computes the event at the snapped point, so every query in a cell gets the same
+  // answer whichever came first. At the default 0.001 degrees (~110 m) that moves a time
+  // by at most ~0.12 s in longitude plus the (latitude dependent, usually smaller) effect
+  // of the latitude step.
+  //
+  // The entries are split over power-of-two shards, each with its own mutex, fixed-size
+  // entry array and open-addressing index. Only misses take the mutex; a hit reads the
+  // shard under a version counter (a seqlock) and retries if a writer got in between,
+  // so threads hitting the same hot key share its lines instead of queueing on a lock.
+  // Hits are counted per thread stripe, misses and evictions per shard. When a shard is
+  // full, CLOCK picks the victim: a hit sets the entry's reference bit, and the hand
+  // evicts the first entry whose bit is clear, clearing the bits it passes. Memory is
+  // fixed at construction, ~48 bytes per entry. A hit is a hash and one or two probes.
+  class ResultCache {
+  public:
+    struct Config {
+      std::size_t capacity = 1u << 16; // entries over all shards
+      double gridDegrees = 0.001;      // lat/lon quantum of the key, > 0
+      std::size_t shards = 0;          // rounded up to a power of two; 0: 4 per hardware thread
+    };
+
+    struct Stats {
+      std::uint64_t hits;
+      std::uint64_t misses;
+      std::uint64_t evictions;
+      std::size_t size;
+      std::size_t capacity;
+    };
+
+    ResultCache ();
+    // An invalid grid is logged and replaced by the default
+    explicit ResultCache (const Config& config);
+    ~ResultCache ();
+
+    ResultCache (const ResultCache&) = delete;
+    ResultCache& operator= (const ResultCache&) = delete;
+
+    // The event at the snapped location, computed and stored on a miss
+    SolarEventTimes get (int year, int month, int day, double lon, double lat,
+                         SolarEvent event = SolarEvent::SunriseSunset);
+
+    // Sunriset::getSunriset through the cache; returns the status code
+    int getSunriset (int year, int month, int day, double lon, double lat, double& rise,
+                     double& set) {
+      const SolarEventTimes times = get (year, month, day, lon, lat);
+      rise = times.start;
+      set = times.end;
+      return times.status;
+    }
+
+    // Counters are summed over the shards without stopping them, so they are only
+    // mutually consistent when no other thread is using the cache
+    Stats stats () const;
+    void resetStats ();
+    void clear ();
+
+    double gridDegrees () const {
+      return grid_;
+    }
+    std::size_t shardCount () const {
+      return shardMask_ + 1;
+    }
+
+  private:
+    struct Key;
+    struct Shard;
+    struct HitCounter;
+
+    double grid_;
+    double inverseGrid_;
+    std::size_t shardMask_;
+    std::unique_ptr<Shard[]> shards_;
+    std::size_t hitCounterMask_;
+    std::unique_ptr<HitCounter[]> hitCounters_;
+  };
+
+} // namespace dotname
+
+#endif // __RESULTCACHE_HPP
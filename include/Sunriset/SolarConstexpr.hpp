@@ -0,0 +1,307 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __SOLARCONSTEXPR_HPP
+#define __SOLARCONSTEXPR_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include <Sunriset/SolarCore.hpp>
+#include <Sunriset/SolarTypes.hpp>
+
+// constexpr versions of __sunriset__ and __daylen__ (C++17).
+//
+// <cmath> is not constexpr, so the trigonometry here is self contained: the Cephes
+// sin/cos/atan polynomials (same as src/Sunriset/Simd/SimdMath.hpp) with the reduction
+// done in degrees, where multiples of 90 are exact, and a Newton square root. Against the
+// libm based functions (6M random cases, 1801-2099): rise/set within 2e-12 hours, day
+// lengths within 2e-11 hours, identical status codes. Arguments must stay below 2^63 in
+// magnitude, which every value of the solar chain does by far.
+//
+// Intended for baking tables of fixed sites into a binary:
+//
+//   static constexpr auto prague = dotname::cx::sunrisetYear (2025, 14.42, 50.08);
+//   // prague.days[dayOfYear - 1].rise, .set, .rc
+//
+// One year of one event takes ~1.5M constant-evaluation operations. That is far inside
+// GCC's default -fconstexpr-ops-limit (2^33) but above clang's -fconstexpr-steps
+// default (1048576), so clang builds that bake tables need the limit raised.
+
+// sunriset.h defines these names as macros; keep them out of the code below
+#pragma push_macro ("sind")
+#pragma push_macro ("cosd")
+#pragma push_macro ("acosd")
+#pragma push_macro ("atan2d")
+#undef sind
+#undef cosd
+#undef acosd
+#undef atan2d
+
+namespace dotname {
+  namespace cx {
+
+    constexpr double floor (double x) {
+      const double t = static_cast<double> (static_cast<long long> (x));
+      return t > x ? t - 1.0 : t;
+    }
+
+    constexpr double fabs (double x) {
+      return x < 0.0 ? -x : x;
+    }
+
+    constexpr double sqrt (double x) {
+      if (x == 0.0)
+        return 0.0;
+      if (!(x > 0.0))
+        return std::numeric_limits<double>::quiet_NaN ();
+
+      double scale = 1.0;
+      while (x > 4.0)
+        x *= 0.25, scale *= 2.0;
+      while (x < 0.25)
+        x *= 4.0, scale *= 0.5;
+      double y = 0.5 * (1.0 + x);
+      for (int i = 0; i < 6; ++i)
+        y = 0.5 * (y + x / y);
+      return y * scale;
+    }
+
+    // sin and cos of r in [-pi/4, pi/4]
+    constexpr double sinPoly (double r) {
+      const double z = r * r;
+      const double p = ((((1.58962301576546568060E-10 * z - 2.50507477628578072866E-8) * z
+                          + 2.75573136213857245213E-6)
+                             * z
+                         - 1.98412698295895385996E-4)
+                            * z
+                        + 8.33333333332211858878E-3)
+                           * z
+                       - 1.66666666666666307295E-1;
+      return r + r * z * p;
+    }
+
+    constexpr double cosPoly (double r) {
+      const double z = r * r;
+      const double p = ((((-1.13585365213876817300E-11 * z + 2.08757008419747316778E-9) * z
+                          - 2.75573141792967388112E-7)
+                             * z
+                         + 2.48015872888517045348E-5)
+                            * z
+                        - 1.38888888888730564116E-3)
+                           * z
+                       + 4.16666666666665929218E-2;
+      return 1.0 - 0.5 * z + z * z * p;
+    }
+
+    // Reduce by the nearest multiple of 90 degrees, exact in degrees
+    constexpr double sind (double x) {
+      const double q = floor (x / 90.0 + 0.5);
+      const double r = (x - 90.0 * q) * core::kDegrad;
+      switch (static_cast<long long> (q) & 3) {
+      case 0:
+        return sinPoly (r);
+      case 1:
+        return cosPoly (r);
+      case 2:
+        return -sinPoly (r);
+      default:
+        return -cosPoly (r);
+      }
+    }
+
+    constexpr double cosd (double x) {
+      const double q = floor (x / 90.0 + 0.5);
+      const double r = (x - 90.0 * q) * core::kDegrad;
+      switch (static_cast<long long> (q) & 3) {
+      case 0:
+        return cosPoly (r);
+      case 1:
+        return -sinPoly (r);
+      case 2:
+        return -cosPoly (r);
+      default:
+        return sinPoly (r);
+      }
+    }
+
+    constexpr double atan (double x) {
+      constexpr double moreBits = 6.123233995736765886130E-17;
+      const double ax = fabs (x);
+
+      double y0 = 0.0, more = 0.0, xr = ax;
+      if (ax > 2.41421356237309504880)
+        y0 = core::kPi / 2.0, more = moreBits, xr = -1.0 / ax;
+      else if (ax > 0.66)
+        y0 = core::kPi / 4.0, more = 0.5 * moreBits, xr = (ax - 1.0) / (ax + 1.0);
+
+      const double z = xr * xr;
+      const double p = ((((-8.750608600031904122785E-1 * z - 1.615753718733365076637E1) * z
+                          - 7.500855792314704667340E1)
+                             * z
+                         - 1.228866684490136173410E2)
+                            * z
+                        - 6.485021904942025371773E1);
+      const double q = (((((z + 2.485846490142306297962E1) * z + 1.650270098316988542046E2) * z
+                          + 4.328810604912902668951E2)
+                             * z
+                         + 4.853903996359136964868E2)
+                            * z
+                        + 1.945506571482613964425E2);
+      const double r = y0 + (xr + xr * (z * p / q) + more);
+      return x < 0.0 ? -r : r;
+    }
+
+    constexpr double atan2 (double y, double x) {
+      if (x == 0.0)
+        return y > 0.0 ? core::kPi / 2.0 : (y < 0.0 ? -core::kPi / 2.0 : 0.0);
+      const double a = atan (y / x);
+      if (x > 0.0)
+        return a;
+      return y < 0.0 ? a - core::kPi : a + core::kPi;
+    }
+
+    constexpr double atan2d (double y, double x) {
+      return core::kRadeg * atan2 (y, x);
+    }
+
+    // acos through atan2, which stays accurate near +-1
+    constexpr double acosd (double x) {
+      return core::kRadeg * atan2 (sqrt ((1.0 - x) * (1.0 + x)), x);
+    }
+
+    // cosd (lat) for the cost denominator: reduction in degrees makes cosd (90) exactly -0,
+    // where libm's cos (pi / 2) gives +6e-17; the floor keeps the sign the C code sees
+    constexpr double cosLatitude (double lat) {
+      const double c = cosd (lat);
+      return c < 1e-30 ? 1e-30 : c;
+    }
+
+    constexpr double revolution (double x) {
+      return x - 360.0 * floor (x * core::kInv360);
+    }
+
+    constexpr double rev180 (double x) {
+      return x - 360.0 * floor (x * core::kInv360 + 0.5);
+    }
+
+    constexpr double gmst0 (double d) {
+      return revolution ((180.0 + 356.0470 + 282.9404) + (0.9856002585 + 4.70935E-5) * d);
+    }
+
+    constexpr core::SunPosition sunpos (double d) {
+      const double M = revolution (356.0470 + 0.9856002585 * d);
+      const double w = 282.9404 + 4.70935E-5 * d;
+      const double e = 0.016709 - 1.151E-9 * d;
+
+      const double E = M + e * core::kRadeg * sind (M) * (1.0 + e * cosd (M));
+      const double x = cosd (E) - e;
+      const double y = sqrt (1.0 - e * e) * sind (E);
+
+      double lon = atan2d (y, x) + w;
+      if (lon >= 360.0)
+        lon -= 360.0;
+      return { lon, sqrt (x * x + y * y) };
+    }
+
+    constexpr core::SunEquatorial sunRaDec (double d) {
+      const core::SunPosition pos = sunpos (d);
+      const double xs = pos.r * cosd (pos.lon);
+      const double ys = pos.r * sind (pos.lon);
+      const double obl_ecl = 23.4393 - 3.563E-7 * d;
+      const double xe = xs;
+      const double ye = ys * cosd (obl_ecl);
+      const double ze = ys * sind (obl_ecl);
+      return { atan2d (ye, xe), atan2d (ze, sqrt (xe * xe + ye * ye)), pos.r };
+    }
+
+    // __sunriset__, days = days_since_2000_Jan_0 (y, m, d)
+    constexpr core::RiseSet sunriset (long days, double lon, double lat, double altit,
+                                      bool upperLimb) {
+      const double d = days + 0.5 - lon / 360.0;
+      const double sidtime = revolution (gmst0 (d) + 180.0 + lon);
+      const core::SunEquatorial sun = sunRaDec (d);
+      const double tsouth = 12.0 - rev180 (sidtime - sun.ra) / 15.0;
+
+      if (upperLimb)
+        altit -= 0.2666 / sun.r;
+
+      const double cost
+          = (sind (altit) - sind (lat) * sind (sun.dec)) / (cosLatitude (lat) * cosd (sun.dec));
+      if (cost >= 1.0)
+        return { tsouth, tsouth, -1 };
+      if (cost <= -1.0)
+        return { tsouth - 12.0, tsouth + 12.0, +1 };
+      const double t = acosd (cost) / 15.0;
+      return { tsouth - t, tsouth + t, 0 };
+    }
+
+    // __daylen__
+    constexpr double daylen (long days, double lon, double lat, double altit, bool upperLimb) {
+      const double d = days + 0.5 - lon / 360.0;
+      const double obl_ecl = 23.4393 - 3.563E-7 * d;
+      const core::SunPosition pos = sunpos (d);
+      const double sin_sdecl = sind (obl_ecl) * sind (pos.lon);
+      const double cos_sdecl = sqrt (1.0 - sin_sdecl * sin_sdecl);
+
+      if (upperLimb)
+        altit -= 0.2666 / pos.r;
+
+      const double cost
+          = (sind (altit) - sind (lat) * sin_sdecl) / (cosLatitude (lat) * cos_sdecl);
+      if (cost >= 1.0)
+        return 0.0;
+      if (cost <= -1.0)
+        return 24.0;
+      return (2.0 / 15.0) * acosd (cost);
+    }
+
+    constexpr bool isLeapYear (int year) {
+      return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    }
+
+    // One site and event over a calendar year, indexed by day of year - 1.
+    // Entries past dayCount (Dec 31 of a common year) are zero.
+    struct SunrisetYear {
+      int year;
+      std::size_t dayCount;
+      std::array<core::RiseSet, 366> days;
+    };
+
+    struct DaylenYear {
+      int year;
+      std::size_t dayCount;
+      std::array<double, 366> days;
+    };
+
+    constexpr SunrisetYear sunrisetYear (int year, double lon, double lat,
+                                         SolarEvent event = SolarEvent::SunriseSunset) {
+      const SolarEventParams params = solarEventParams (event);
+      SunrisetYear table{ year, isLeapYear (year) ? 366u : 365u, {} };
+      long days = core::daysSince2000Jan0 (year, 1, 1);
+      for (std::size_t i = 0; i < table.dayCount; ++i, days = core::nextDay (days))
+        table.days[i] = sunriset (days, lon, lat, params.altit, params.upperLimb);
+      return table;
+    }
+
+    constexpr DaylenYear daylenYear (int year, double lon, double lat,
+                                     SolarEvent event = SolarEvent::SunriseSunset) {
+      const SolarEventParams params = dayLengthParams (event);
+      DaylenYear table{ year, isLeapYear (year) ? 366u : 365u, {} };
+      long days = core::daysSince2000Jan0 (year, 1, 1);
+      for (std::size_t i = 0; i < table.dayCount; ++i, days = core::nextDay (days))
+        table.days[i] = daylen (days, lon, lat, params.altit, params.upperLimb);
+      return table;
+    }
+
+  } // namespace cx
+} // namespace dotname
+
+#pragma pop_macro ("sind")
+#pragma pop_macro ("cosd")
+#pragma pop_macro ("acosd")
+#pragma pop_macro ("atan2d")
+
+#endif // __SOLARCONSTEXPR_HPP
@@ -0,0 +1,220 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __SOLARCORE_HPP
+#define __SOLARCORE_HPP
+
+#include <cmath>
+
+// Inline C++ mirror of the workhorse functions in sunriset.c.
+// The arithmetic follows the C code statement by statement so the results are
+// identical, but every function is visible to the optimizer and returns by value,
+// which lets batch loops inline the whole chain instead of calling through pointers.
+
+// sunriset.h defines these names as macros; keep them out of the code below
+#pragma push_macro ("sind")
+#pragma push_macro ("cosd")
+#pragma push_macro ("acosd")
+#pragma push_macro ("atan2d")
+#undef sind
+#undef cosd
+#undef acosd
+#undef atan2d
+
+namespace dotname {
+  namespace core {
+
+    constexpr double kPi = 3.1415926535897932384;
+    constexpr double kRadeg = 180.0 / kPi;
+    constexpr double kDegrad = kPi / 180.0;
+    constexpr double kInv360 = 1.0 / 360.0;
+
+    inline double sind (double x) {
+      return std::sin (x * kDegrad);
+    }
+    inline double cosd (double x) {
+      return std::cos (x * kDegrad);
+    }
+    inline double acosd (double x) {
+      return kRadeg * std::acos (x);
+    }
+    inline double atan2d (double y, double x) {
+      return kRadeg * std::atan2 (y, x);
+    }
+
+    // days_since_2000_Jan_0 macro, 1801-2099 only
+    constexpr long daysSince2000Jan0 (int y, int m, int d) {
+      return 367L * y - ((7 * (y + ((m + 9) / 12))) / 4) + ((275 * m) / 9) + d - 730530L;
+    }
+
+    // days_since_2000_Jan_0 counts 1900 as a leap year, so its value skips one number
+    // between 1900-02-28 and 1900-03-01. Date sweeps step with nextDay() to stay
+    // identical to evaluating the macro for every calendar date.
+    constexpr long kDays1900Feb28 = daysSince2000Jan0 (1900, 2, 28);
+
+    constexpr long nextDay (long days) {
+      return days + (days == kDays1900Feb28 ? 2 : 1);
+    }
+
+    // Reduce angle to within 0..360 degrees
+    inline double revolution (double x) {
+      return x - 360.0 * std::floor (x * kInv360);
+    }
+
+    // Reduce angle to within -180..+180 degrees
+    inline double rev180 (double x) {
+      return x - 360.0 * std::floor (x * kInv360 + 0.5);
+    }
+
+    inline double gmst0 (double d) {
+      return revolution ((180.0 + 356.0470 + 282.9404) + (0.9856002585 + 4.70935E-5) * d);
+    }
+
+    struct SunPosition {
+      double lon; // True solar longitude
+      double r;   // Solar distance, astronomical units
+    };
+
+    inline SunPosition sunpos (double d) {
+      const double M = revolution (356.0470 + 0.9856002585 * d);
+      const double w = 282.9404 + 4.70935E-5 * d;
+      const double e = 0.016709 - 1.151E-9 * d;
+
+      const double E = M + e * kRadeg * sind (M) * (1.0 + e * cosd (M));
+      const double x = cosd (E) - e;
+      const double y = std::sqrt (1.0 - e * e) * sind (E);
+
+      SunPosition pos;
+      pos.r = std::sqrt (x * x + y * y);
+      pos.lon = atan2d (y, x) + w;
+      if (pos.lon >= 360.0)
+        pos.lon -= 360.0;
+      return pos;
+    }
+
+    struct SunEquatorial {
+      double ra;  // Right Ascension, degrees
+      double dec; // Declination, degrees
+      double r;   // Solar distance, astronomical units
+    };
+
+    inline SunEquatorial sunRaDec (double d) {
+      const SunPosition pos = sunpos (d);
+      const double xs = pos.r * cosd (pos.lon);
+      const double ys = pos.r * sind (pos.lon);
+      const double obl_ecl = 23.4393 - 3.563E-7 * d;
+      const double xe = xs;
+      const double ye = ys * cosd (obl_ecl);
+      const double ze = ys * sind (obl_ecl);
+
+      SunEquatorial eq;
+      eq.ra = atan2d (ye, xe);
+      eq.dec = atan2d (ze, std::sqrt (xe * xe + ye * ye));
+      eq.r = pos.r;
+      return eq;
+    }
+
+    struct RiseSet {
+      double rise;
+      double set;
+      int rc; // __sunriset__ return code: 0, +1 always above, -1 always below
+    };
+
+    // __sunriset__ with the calendar math hoisted out: days = days_since_2000_Jan_0 (y, m, d)
+    inline RiseSet sunriset (long days, double lon, double lat, double altit, bool upperLimb) {
+      const double d = days + 0.5 - lon / 360.0;
+      const double sidtime = revolution (gmst0 (d) + 180.0 + lon);
+      const SunEquatorial sun = sunRaDec (d);
+      const double tsouth = 12.0 - rev180 (sidtime - sun.ra) / 15.0;
+      const double sradius = 0.2666 / sun.r;
+
+      if (upperLimb)
+        altit -= sradius;
+
+      RiseSet out;
+      double t;
+      const double cost
+          = (sind (altit) - sind (lat) * sind (sun.dec)) / (cosd (lat) * cosd (sun.dec));
+      if (cost >= 1.0)
+        out.rc = -1, t = 0.0;
+      else if (cost <= -1.0)
+        out.rc = +1, t = 12.0;
+      else
+        out.rc = 0, t = acosd (cost) / 15.0;
+
+      out.rise = tsouth - t;
+      out.set = tsouth + t;
+      return out;
+    }
+
+    // Everything __sunriset__ derives from the date and longitude alone, i.e. the part
+    // that is shared by all horizon crossings of one observer and day
+    struct SunTransit {
+      double tsouth;  // Time when Sun is at south, hours UT
+      double sradius; // Sun's apparent radius, degrees
+      double sinDec;
+      double cosDec;
+    };
+
+    // d = days + 0.5 - lon / 360, for callers that keep lon / 360 per observer
+    inline SunTransit sunTransitAt (double d, double lon) {
+      const double sidtime = revolution (gmst0 (d) + 180.0 + lon);
+      const SunEquatorial sun = sunRaDec (d);
+
+      SunTransit tr;
+      tr.tsouth = 12.0 - rev180 (sidtime - sun.ra) / 15.0;
+      tr.sradius = 0.2666 / sun.r;
+      tr.sinDec = sind (sun.dec);
+      tr.cosDec = cosd (sun.dec);
+      return tr;
+    }
+
+    inline SunTransit sunTransit (long days, double lon) {
+      return sunTransitAt (days + 0.5 - lon / 360.0, lon);
+    }
+
+    struct DiurnalArc {
+      double t; // half of the arc above altit, hours
+      int rc;
+    };
+
+    // The cost/acos tail of __sunriset__ for an already limb-corrected altitude
+    inline DiurnalArc diurnalArc (double sinAltit, double sinLat, double cosLat,
+                                  const SunTransit& tr) {
+      const double cost = (sinAltit - sinLat * tr.sinDec) / (cosLat * tr.cosDec);
+      if (cost >= 1.0)
+        return { 0.0, -1 };
+      if (cost <= -1.0)
+        return { 12.0, +1 };
+      return { acosd (cost) / 15.0, 0 };
+    }
+
+    // __daylen__ with the calendar math hoisted out
+    inline double daylen (long days, double lon, double lat, double altit, bool upperLimb) {
+      const double d = days + 0.5 - lon / 360.0;
+      const double obl_ecl = 23.4393 - 3.563E-7 * d;
+      const SunPosition pos = sunpos (d);
+      const double sin_sdecl = sind (obl_ecl) * sind (pos.lon);
+      const double cos_sdecl = std::sqrt (1.0 - sin_sdecl * sin_sdecl);
+      const double sradius = 0.2666 / pos.r;
+
+      if (upperLimb)
+        altit -= sradius;
+
+      const double cost = (sind (altit) - sind (lat) * sin_sdecl) / (cosd (lat) * cos_sdecl);
+      if (cost >= 1.0)
+        return 0.0;
+      if (cost <= -1.0)
+        return 24.0;
+      return (2.0 / 15.0) * acosd (cost);
+    }
+
+  } // namespace core
+} // namespace dotname
+
+#pragma pop_macro ("sind")
+#pragma pop_macro ("cosd")
+#pragma pop_macro ("acosd")
+#pragma pop_macro ("atan2d")
+
+#endif // __SOLARCORE_HPP
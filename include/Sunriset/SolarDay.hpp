@@ -0,0 +1,49 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __SOLARDAY_HPP
+#define __SOLARDAY_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <Sunriset/SolarTypes.hpp>
+
+namespace dotname {
+
+  struct SolarEventTimes {
+    double start;       // rise / twilight start, hours UT
+    double end;         // set / twilight end, hours UT
+    std::int8_t status; // see SolarStatus
+  };
+
+  // All horizon crossings of one observer and day
+  struct SolarDay {
+    double solarNoon;               // time when the Sun is at south, hours UT
+    SolarEventTimes events[4];      // indexed by SolarEvent
+    double dayLength;               // day_length (upper limb at -50 arc minutes)
+    double civilTwilightLength;     // day_civil_twilight_length
+    double nauticalTwilightLength;  // day_nautical_twilight_length
+    double astronomicalTwilightLength; // day_astronomical_twilight_length
+
+    const SolarEventTimes& operator[] (SolarEvent event) const {
+      return events[static_cast<std::size_t> (event)];
+    }
+  };
+
+  // Evaluates the ephemeris (days_since_2000_Jan_0, GMST0, sun_RA_dec, sind/cosd of the
+  // latitude) once and derives the four event pairs, the __daylen__ variants and solar
+  // noon from it. Event times are identical to the sun_rise_set / *_twilight macros;
+  // day lengths agree with the day_*_length macros to rounding (below 1e-12 hours).
+  SolarDay solarDay (int year, int month, int day, double lon, double lat);
+
+  void solarDayBatch (int year, int month, int day, const double* lon, const double* lat,
+                      std::size_t count, SolarDay* out);
+
+  // One observer over `dayCount` consecutive days, the day number is stepped in place
+  void solarDayRange (int year, int month, int day, std::size_t dayCount, double lon, double lat,
+                      SolarDay* out);
+
+} // namespace dotname
+
+#endif // __SOLARDAY_HPP
@@ -0,0 +1,159 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __SOLARPACKING_HPP
+#define __SOLARPACKING_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <Sunriset/SolarDay.hpp>
+#include <Sunriset/SolarTypes.hpp>
+
+namespace dotname {
+
+  // Compact encodings of event times for tables and caches.
+  //
+  // __sunriset__ returns times in [-12.3, 36.3] hours UT around the date (south time
+  // -/+ 12 hours at most). A packed time counts whole quanta from -16:00 UT of the date,
+  // so that range always fits and negative / next-day times survive the round trip.
+  // Decoding returns the middle of the quantum: the error is at most half a quantum
+  // (30 s at minute resolution) and doubleTo24Time prints the same hh:mm as for the
+  // exact value.
+
+  constexpr double kPackedTimeOriginHours = -16.0;
+
+  // One time in 16 bits: minutes since -16:00 UT in bits 0-11 (up to 52:15 UT), the
+  // event's SolarStatus in bits 12-13 (0, 1: AlwaysAbove, 2: AlwaysBelow). Out-of-range
+  // times are clamped.
+  using PackedTime = std::uint16_t;
+
+  // A rise/set pair in 4 bytes instead of the 24 of SolarEventTimes; the status is kept
+  // in `start`
+  struct PackedEventTimes {
+    PackedTime start;
+    PackedTime end;
+  };
+
+  namespace packing {
+    constexpr unsigned kMinuteBits = 12;
+    constexpr std::uint16_t kMinuteMask = (1u << kMinuteBits) - 1;
+
+    inline unsigned statusCode (std::int8_t status) {
+      return status > 0 ? 1u : status < 0 ? 2u : 0u;
+    }
+    inline std::int8_t statusFromCode (unsigned code) {
+      return code == 1 ? SolarStatus::AlwaysAbove
+                       : code == 2 ? SolarStatus::AlwaysBelow : SolarStatus::RisesAndSets;
+    }
+    // Whole quanta since the origin, clamped to [0, limit]; NaN maps to 0
+    inline std::uint32_t quantize (double hours, double quantaPerHour, std::uint32_t limit) {
+      const double q = std::floor ((hours - kPackedTimeOriginHours) * quantaPerHour);
+      return q >= static_cast<double> (limit) ? limit
+                                              : q >= 0.0 ? static_cast<std::uint32_t> (q) : 0u;
+    }
+    inline double dequantize (std::uint32_t q, double hoursPerQuantum) {
+      return (static_cast<double> (q) + 0.5) * hoursPerQuantum + kPackedTimeOriginHours;
+    }
+  } // namespace packing
+
+  inline PackedTime packTime (double hours, std::int8_t status = SolarStatus::RisesAndSets) {
+    return static_cast<PackedTime> (packing::quantize (hours, 60.0, packing::kMinuteMask)
+                                    | packing::statusCode (status) << packing::kMinuteBits);
+  }
+  inline double unpackHours (PackedTime packed) {
+    return packing::dequantize (packed & packing::kMinuteMask, 1.0 / 60.0);
+  }
+  inline std::int8_t unpackStatus (PackedTime packed) {
+    return packing::statusFromCode ((packed >> packing::kMinuteBits) & 3u);
+  }
+
+  inline PackedEventTimes pack (const SolarEventTimes& times) {
+    return { packTime (times.start, times.status), packTime (times.end) };
+  }
+  inline SolarEventTimes unpack (PackedEventTimes packed) {
+    return { unpackHours (packed.start), unpackHours (packed.end), unpackStatus (packed.start) };
+  }
+
+  // The rise / set / status arrays of sunrisetBatch* to and from packed pairs
+  void packBatch (const double* start, const double* end, const std::int8_t* status,
+                  std::size_t count, PackedEventTimes* out);
+  void unpackBatch (const PackedEventTimes* packed, std::size_t count, double* start,
+                    double* end, std::int8_t* status);
+
+  // One event of one site over consecutive days, delta coded.
+  //
+  // Times are quantized to `resolutionSeconds` (1 to 3600) from the same origin as
+  // PackedTime. Days are grouped in blocks of kBlockDays; the block index keeps each
+  // block's first start/end and bit position, so any day is reached by decoding at most
+  // one block. Within a block the day-to-day differences of start and end are zigzag
+  // coded and bit-packed at the width of the block's largest one; the status is stored
+  // once for the block when it does not change, otherwise at 2 bits per day.
+  //
+  // Rise and set move by a few minutes a day away from the poles, so a year at minute
+  // resolution packs into 2-3 bits per time: ~360 bytes with the index, against 8.8 kB
+  // of SolarEventTimes. Blocks around polar day/night transitions, where the times jump
+  // by hours, are wider but stay exact to the quantum.
+  class PackedSeries {
+  public:
+    static constexpr std::size_t kBlockDays = 64;
+
+    PackedSeries () = default;
+
+    // false (and logged) for a resolution outside 1-3600 s; the series is left empty
+    bool encode (const double* start, const double* end, const std::int8_t* status,
+                 std::size_t count, unsigned resolutionSeconds = 60);
+    bool encode (const SolarDay* days, std::size_t count, SolarEvent event,
+                 unsigned resolutionSeconds = 60);
+    void clear ();
+
+    std::size_t size () const {
+      return count_;
+    }
+    bool empty () const {
+      return count_ == 0;
+    }
+    unsigned resolutionSeconds () const {
+      return resolution_;
+    }
+    // Largest decoding error, hours
+    double maxError () const {
+      return 0.5 * resolution_ / 3600.0;
+    }
+    // Memory held by the encoded series
+    std::size_t byteSize () const {
+      return blocks_.size () * sizeof (Block) + bits_.size () * sizeof (std::uint64_t);
+    }
+
+    // One day; decodes up to its position within its block
+    SolarEventTimes at (std::size_t index) const;
+
+    // Days [first, first + count) into the sunrisetBatch* output layout
+    void decode (std::size_t first, std::size_t count, double* start, double* end,
+                 std::int8_t* status) const;
+
+  private:
+    struct Block {
+      std::uint32_t bitOffset;
+      std::uint32_t firstStart; // quanta since the origin
+      std::uint32_t firstEnd;
+      std::uint8_t startBits;   // width of a zigzag start delta
+      std::uint8_t endBits;
+      std::uint8_t status;      // status code of every day, 3 when stored per day
+      std::uint8_t reserved;
+    };
+
+    void decodeBlock (std::size_t block, std::size_t from, std::size_t to, double* start,
+                      double* end, std::int8_t* status) const;
+
+    std::vector<Block> blocks_;
+    std::vector<std::uint64_t> bits_; // one spare word so every read may touch two
+    std::size_t count_ = 0;
+    unsigned resolution_ = 60;
+  };
+
+} // namespace dotname
+
+#endif // __SOLARPACKING_HPP
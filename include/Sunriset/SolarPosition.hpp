@@ -0,0 +1,110 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __SOLARPOSITION_HPP
+#define __SOLARPOSITION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <Sunriset/SolarTypes.hpp>
+
+namespace dotname {
+
+  // The Sun at one instant, from the same sun_RA_dec and GMST0 as __sunriset__.
+  //
+  // d counts days since 2000 Jan 0.0 UT including the time of day, i.e.
+  // days_since_2000_Jan_0 (y, m, d) + hoursUT / 24. The subsolar point is where the Sun
+  // stands in the zenith: latitude = declination, longitude = RA - GMST. Elevations are
+  // geometric (no refraction) and refer to the Sun's center.
+  //
+  // __sunriset__ takes the declination at local noon for both crossings, so at the times
+  // it returns the elevation computed here is off its horizon by the declination's change
+  // over the half day, up to ~0.1 degrees (well under a minute of time) near the equinoxes.
+  struct SubsolarPoint {
+    double d;
+    double lat;     // = declination, degrees
+    double lon;     // degrees east, -180..180
+    double sinDec;
+    double cosDec;
+    double sradius; // apparent radius, degrees
+  };
+
+  SubsolarPoint subsolarPoint (double d);
+  SubsolarPoint subsolarPoint (int year, int month, int day, double hoursUT);
+
+  // Elevation of the Sun's center above the horizon, degrees
+  double solarElevation (const SubsolarPoint& sun, double lat, double lon);
+
+  struct HorizontalPosition {
+    double elevation; // degrees above the horizon
+    double azimuth;   // degrees from north through east, 0..360
+  };
+
+  HorizontalPosition solarPosition (const SubsolarPoint& sun, double lat, double lon);
+
+  // Elevation/azimuth of the Sun at `count` instants startD + k * stepSeconds, shared by
+  // any number of observers (e.g. the panels of a solar tracker).
+  //
+  // The ephemeris is evaluated exactly only at anchors every `anchorInterval` samples, at
+  // the last one and halfway between anchors. In between, the hour angle and the
+  // declination follow the quadratic through those three points (the declination's
+  // curvature matters near the solstices, where its rate goes through zero). Their sines
+  // and cosines advance by the rotation recurrence sin (x + s) = sin x cos s + cos x sin s,
+  // cos (x + s) = ..., with the step s itself rotated by a constant each sample, so a
+  // sample costs a few multiplications plus the asin/atan2 of the result instead of
+  // sun_RA_dec, GMST0 and the hour angle trigonometry.
+  //
+  // Against solarPosition () at every sample, for dates all over 1801-2099 and all
+  // latitudes, 5 s steps with the default interval (21 minutes) and 60 s steps (4.3 hours)
+  // stay within 2e-8 degrees of elevation and, below 85 degrees from the horizon, 1e-7
+  // of azimuth. Within a degree of the zenith or nadir asin's rounding (in both) reaches
+  // 6e-7 degrees of elevation, and the azimuth, undefined at the pole of the horizon,
+  // differs by up to 2e-5 degrees.
+  class SolarPositionSeries {
+  public:
+    SolarPositionSeries (double startD, double stepSeconds, std::size_t count,
+                         std::size_t anchorInterval = 256);
+    SolarPositionSeries (int year, int month, int day, double startHoursUT, double stepSeconds,
+                         std::size_t count, std::size_t anchorInterval = 256);
+
+    std::size_t size () const {
+      return count_;
+    }
+    // Instant of sample k, days since 2000 Jan 0.0 UT
+    double instant (std::size_t k) const {
+      return startD_ + static_cast<double> (k) * step_;
+    }
+
+    // One observer; elevation and azimuth hold size () elements, either may be nullptr
+    void evaluate (double lat, double lon, double* elevation, double* azimuth) const;
+
+  private:
+    double startD_;
+    double step_; // days
+    std::size_t count_;
+    std::vector<std::size_t> anchorSample_;
+    std::vector<SubsolarPoint> anchors_;
+    std::vector<SubsolarPoint> midpoints_; // halfway between consecutive anchors
+  };
+
+  // Where an observer is relative to the terminator and the twilight lines. Day means
+  // the upper limb is above the sun_rise_set horizon (-35 arc minutes); the twilights
+  // are bounded by the center at -6, -12 and -18 degrees, as in the *_twilight macros.
+  enum class Illumination : std::uint8_t {
+    Day,
+    CivilTwilight,
+    NauticalTwilight,
+    AstronomicalTwilight,
+    Night
+  };
+
+  // Lower elevation bound of each class for this Sun (Night: -90)
+  double illuminationFloor (const SubsolarPoint& sun, Illumination state);
+
+  Illumination illumination (const SubsolarPoint& sun, double lat, double lon);
+
+} // namespace dotname
+
+#endif // __SOLARPOSITION_HPP
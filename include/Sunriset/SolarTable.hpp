@@ -0,0 +1,134 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __SOLARTABLE_HPP
+#define __SOLARTABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+#include <Sunriset/SolarDay.hpp>
+#include <Sunriset/SolarTypes.hpp>
+
+namespace dotname {
+
+  // Precomputed per-site, per-day results in a memory-mapped columnar file.
+  //
+  // generate () evaluates solarDayRange for every site and day once; open () maps the
+  // file read-only and only validates the header, so a table of any size is ready
+  // immediately and the pages a service never asks for are never read. A site id is
+  // found through an open-addressing hash stored in the file and a (site, day) cell is
+  // an index into each column, both O(1). Values are those of solarDay, i.e. identical
+  // to the sun_rise_set / *_twilight and day_*_length macros.
+  //
+  // File layout, version 1, native byte order (a byte-order mark is checked on open),
+  // every section aligned to 64 bytes:
+  //   header      magic "SRTABLE\0", version, byte-order mark, site and day counts, first
+  //               day (days since 2000 Jan 0.0), event mask, section offsets, file size
+  //   site hash   u32 slots (power of two, >= 2 * sites): site index + 1, 0 when empty
+  //   sites       { u64 id, f64 lat, f64 lon } in generation order
+  //   directory   per column { u8 event (0xff: solar noon), u8 field, u16 element
+  //               bytes, u32 reserved, u64 offset }
+  //   columns     site-major, element [site * dayCount + day]: f64 hours for solar noon,
+  //               Start, End and Length, i8 SolarStatus for Status
+  //
+  // Tables are meant to ship as assets: Sunriset::openTable () resolves a relative name
+  // against the assets path, and tools/ builds SunrisetTableGen to write them.
+  class SolarTable {
+  public:
+    enum class Field : std::uint8_t {
+      Start,  // rise / twilight start, hours UT
+      End,    // set / twilight end, hours UT
+      Length, // day_length / day_*_twilight_length, hours
+      Status  // SolarStatus of the event
+    };
+
+    struct Site {
+      std::uint64_t id;
+      double lat;
+      double lon;
+    };
+
+    static constexpr std::size_t npos = ~std::size_t{ 0 };
+    static constexpr std::uint8_t kAllEvents = 0x0f; // bit (1 << SolarEvent)
+    static constexpr std::uint32_t kVersion = 1;
+
+    // Writes sites x dayCount days starting at year-month-day. eventMask selects the
+    // events stored (solar noon always is). Site ids must be unique.
+    static bool generate (const std::filesystem::path& filePath, const std::vector<Site>& sites,
+                          int year, int month, int day, std::size_t dayCount,
+                          std::uint8_t eventMask = kAllEvents);
+
+    SolarTable ();
+    explicit SolarTable (const std::filesystem::path& filePath);
+    ~SolarTable ();
+    SolarTable (SolarTable&& other) noexcept;
+    SolarTable& operator= (SolarTable&& other) noexcept;
+
+    // Maps the file; false (and logged) when it is missing, truncated or not a version 1
+    // table of this byte order
+    bool open (const std::filesystem::path& filePath);
+    void close ();
+    bool isOpen () const {
+      return base_ != nullptr;
+    }
+
+    std::size_t siteCount () const {
+      return siteCount_;
+    }
+    std::size_t dayCount () const {
+      return dayCount_;
+    }
+    // Day index 0 in days since 2000 Jan 0.0
+    long firstDay () const {
+      return firstDay_;
+    }
+    bool hasEvent (SolarEvent event) const {
+      return (eventMask_ >> static_cast<unsigned> (event)) & 1u;
+    }
+
+    const Site& site (std::size_t index) const {
+      return sites_[index];
+    }
+    // Site index of an id, npos when the table does not have it
+    std::size_t findSite (std::uint64_t id) const;
+    // npos outside the table
+    std::size_t dayIndex (int year, int month, int day) const;
+
+    // Whole columns, nullptr when the event is not stored. Element [site * dayCount () + day].
+    const double* solarNoon () const {
+      return noon_;
+    }
+    const double* column (SolarEvent event, Field field) const;
+    const std::int8_t* statusColumn (SolarEvent event) const;
+
+    // One cell, O(1); the event must be stored
+    SolarEventTimes at (std::size_t site, std::size_t day, SolarEvent event) const;
+
+    // By site id and date, false when either is not in the table or the event is not stored
+    bool lookup (std::uint64_t siteId, int year, int month, int day, SolarEvent event,
+                 SolarEventTimes& out) const;
+
+  private:
+    struct Mapping;
+
+    std::unique_ptr<Mapping> mapping_;
+    const char* base_ = nullptr;
+    std::size_t siteCount_ = 0;
+    std::size_t dayCount_ = 0;
+    long firstDay_ = 0;
+    std::uint8_t eventMask_ = 0;
+    const std::uint32_t* hash_ = nullptr;
+    std::uint32_t hashMask_ = 0;
+    const Site* sites_ = nullptr;
+    const double* noon_ = nullptr;
+    const double* columns_[4][3] = {};      // [event][Start, End, Length]
+    const std::int8_t* status_[4] = {};     // [event]
+  };
+
+} // namespace dotname
+
+#endif // __SOLARTABLE_HPP
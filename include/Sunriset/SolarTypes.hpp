@@ -0,0 +1,54 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __SOLARTYPES_HPP
+#define __SOLARTYPES_HPP
+
+#include <cstdint>
+
+namespace dotname {
+
+  // Horizon crossings supported by the library, mirroring the macros in sunriset.h
+  enum class SolarEvent : std::uint8_t {
+    SunriseSunset,       // sun_rise_set: upper limb at -35 arc minutes
+    CivilTwilight,       // civil_twilight: center at -6 degrees
+    NauticalTwilight,    // nautical_twilight: center at -12 degrees
+    AstronomicalTwilight // astronomical_twilight: center at -18 degrees
+  };
+
+  // Return codes of __sunriset__, kept as a compact per-element status
+  namespace SolarStatus {
+    constexpr std::int8_t RisesAndSets = 0;
+    constexpr std::int8_t AlwaysAbove = +1; // rise/set = south time -/+ 12 hours
+    constexpr std::int8_t AlwaysBelow = -1; // rise/set = south time
+  }
+
+  struct SolarEventParams {
+    double altit;
+    bool upperLimb;
+  };
+
+  constexpr SolarEventParams solarEventParams (SolarEvent event) {
+    switch (event) {
+    case SolarEvent::CivilTwilight:
+      return { -6.0, false };
+    case SolarEvent::NauticalTwilight:
+      return { -12.0, false };
+    case SolarEvent::AstronomicalTwilight:
+      return { -18.0, false };
+    case SolarEvent::SunriseSunset:
+    default:
+      return { -35.0 / 60.0, true };
+    }
+  }
+
+  // Altitude and limb flag of the day_length / day_*_twilight_length macros. Only the
+  // plain day length differs from the rise/set macros: it uses -50 arc minutes.
+  constexpr SolarEventParams dayLengthParams (SolarEvent event) {
+    return event == SolarEvent::SunriseSunset ? SolarEventParams{ -50.0 / 60.0, true }
+                                              : solarEventParams (event);
+  }
+
+} // namespace dotname
+
+#endif // __SOLARTYPES_HPP
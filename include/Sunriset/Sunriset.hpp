@@ -4,9 +4,13 @@
 #ifndef __SUNRISET_HPP
 #define __SUNRISET_HPP
 
+#include <cstdint>
 #include <filesystem>
+#include <memory>
 #include <string>
 #include <Sunriset/version.h>
+// The per-event kernels (sunrisetFor<E>, daylenFor<E>) are part of the public API
+#include <Sunriset/SolarKernels.hpp>
 
 extern "C" {
 #include "Sunriset/sunriset.h"
@@ -16,15 +20,32 @@ extern "C" {
 
 namespace dotname {
 
+  class SolarTable;
+  class ResultCache;
+  class ChebyshevEphemeris;
+  enum class EphemerisModel : std::uint8_t;
+
+  // The table, cache and fitted ephemeris are optional and shared: copies of a Sunriset
+  // refer to the same ones. Their headers are included by the code that uses them.
   class Sunriset {
 
     const std::string libName = std::string ("Sunriset v.") + SUNRISET_VERSION;
     std::filesystem::path assetsPath_;
+    std::shared_ptr<const SolarTable> table_;
+    std::shared_ptr<ResultCache> cache_;
+    std::shared_ptr<const ChebyshevEphemeris> chebyshev_;
+
+    int getSunrisetRouted (int year, int month, int day, double lon, double lat, double& rise,
+                           double& set) const;
 
   public:
     Sunriset ();
     Sunriset (const std::filesystem::path& assetsPath);
     Sunriset (int year, int month, int day, double lon, double lat);
+    Sunriset (const Sunriset& other);
+    Sunriset (Sunriset&& other) noexcept;
+    Sunriset& operator= (const Sunriset& other);
+    Sunriset& operator= (Sunriset&& other) noexcept;
     ~Sunriset ();
 
     const std::filesystem::path getAssetsPath () const {
@@ -35,9 +56,32 @@ namespace dotname {
     }
     std::string doubleTo24Time (double time);
 
-    void getSunriset (int year, int month, int day, double lon, double lat, double& rise,
-                      double& set) {
-      sun_rise_set (year, month, day, lon, lat, &rise, &set);
+    // returns the __sunriset__ status code, see SolarStatus
+    int getSunriset (int year, int month, int day, double lon, double lat, double& rise,
+                     double& set) {
+      if (cache_ || chebyshev_) {
+        return getSunrisetRouted (year, month, day, lon, lat, rise, set);
+      }
+      return sun_rise_set (year, month, day, lon, lat, &rise, &set);
+    }
+
+    // Routes getSunriset through `cache` (nullptr turns it off): answers are then those of
+    // the location snapped to the cache's grid
+    void setCache (std::shared_ptr<ResultCache> cache);
+    ResultCache* getCache () const {
+      return cache_.get ();
+    }
+
+    // Ephemeris behind getSunriset when no cache is set. Switching to Chebyshev fits the
+    // polynomials (~20 ms) unless they are already there.
+    void setEphemerisModel (EphemerisModel model);
+    EphemerisModel getEphemerisModel () const;
+
+    // Maps a precomputed SolarTable; a relative fileName is taken from the assets path
+    bool openTable (const std::filesystem::path& fileName);
+    // nullptr until openTable succeeds
+    const SolarTable* getTable () const {
+      return table_.get ();
     }
   };
 
@@ -0,0 +1,86 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __TERMINATOR_HPP
+#define __TERMINATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <Sunriset/Batch.hpp>
+#include <Sunriset/LocationSet.hpp>
+#include <Sunriset/SolarPosition.hpp>
+
+namespace dotname {
+
+  // "Which sites are in daylight / twilight / night at instant d?" over a LocationSet.
+  //
+  // build () snapshots the live sites sorted into latitude bands. A query computes the
+  // subsolar point once; each site's elevation is then sin (lat) sin (dec) +
+  // cos (lat) cos (dec) cos (lon - subsolar lon), evaluated by the vector kernels
+  // (SSE2/AVX2/AVX-512) with the latitude terms taken from the set. The elevation range
+  // over every longitude of a band follows from its latitude range and the declination,
+  // so a band that lies wholly inside the requested class (polar day or night) is taken
+  // without evaluating its sites, and a band that cannot reach it is skipped.
+  //
+  // A site exactly on a class boundary may land on either side depending on the SIMD
+  // level (the vector cosine differs from the C library one by ~1e-16).
+  class TerminatorIndex {
+  public:
+    struct QueryStats {
+      std::size_t bandsTaken;     // wholly inside the class, no site evaluated
+      std::size_t bandsSkipped;   // wholly outside the class
+      std::size_t bandsEvaluated;
+      std::size_t sitesEvaluated;
+      std::size_t matches;
+    };
+
+    explicit TerminatorIndex (double bandDegrees = 1.0);
+
+    // Snapshot of the live sites of `sites`; call again after the set changes
+    void build (const LocationSet& sites);
+
+    // Number of LocationSet slots covered, the bitmap length in bits
+    std::size_t slotCount () const {
+      return slotCount_;
+    }
+    std::size_t siteCount () const {
+      return slot_.size ();
+    }
+    std::size_t bandCount () const {
+      return bandBegin_.size () - 1;
+    }
+
+    // Bit `slot` of bitmap (64 slots per word) is set for every site in `state`
+    QueryStats selectBitmap (const SubsolarPoint& sun, Illumination state,
+                             std::vector<std::uint64_t>& bitmap,
+                             SimdLevel level = SimdLevel::Auto) const;
+
+    // Ids of the sites in `state`, in band order
+    QueryStats selectIds (const SubsolarPoint& sun, Illumination state,
+                          std::vector<std::uint64_t>& ids, SimdLevel level = SimdLevel::Auto) const;
+
+  private:
+    template <class Emit>
+    QueryStats select (const SubsolarPoint& sun, Illumination state, SimdLevel level,
+                       Emit emit) const;
+
+    double bandDegrees_;
+    std::size_t slotCount_ = 0;
+    // Band b holds entries [bandBegin_[b], bandBegin_[b + 1]), latitudes within
+    // [bandLatMin_[b], bandLatMax_[b]]
+    std::vector<std::size_t> bandBegin_;
+    std::vector<double> bandLatMin_;
+    std::vector<double> bandLatMax_;
+    std::vector<std::size_t> slot_;
+    std::vector<std::uint64_t> id_;
+    std::vector<double> lon_;
+    std::vector<double> sinLat_;
+    std::vector<double> cosLat_;
+    std::size_t largestBand_ = 0;
+  };
+
+} // namespace dotname
+
+#endif // __TERMINATOR_HPP
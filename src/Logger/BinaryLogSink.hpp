@@ -0,0 +1,312 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+// Binary deferred-format sink for Logger::logFmtMessage
+
+#ifndef BINARYLOGSINK_HPP
+#define BINARYLOGSINK_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "fmt/core.h"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  #include <intrin.h>
+  #define BINARYLOG_HAS_TSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+  #include <x86intrin.h>
+  #define BINARYLOG_HAS_TSC 1
+#endif
+
+// File layout, native byte order (decode on a machine of the same endianness):
+//   header   "SRBLOG1\0", u64 system_clock ns, u64 steady_clock ns, sampled together
+//   records  u8 Kind, then
+//     Define u32 id, u8 level, u32 length + format, u32 length + caller
+//     Event  u32 id, u64 ticks, u8 argument count, per argument u8 ArgTag + value
+//     Clock  u64 ticks, u64 steady_clock ns, sampled together
+// Ticks are the TSC where available and steady_clock ns elsewhere; every flushed block
+// ends with a Clock record, so the decoder converts by interpolating between them.
+// Strings are u32 length + bytes. A Define precedes the first Event that uses its id.
+namespace BinaryLog {
+
+  constexpr char kMagic[8] = { 'S', 'R', 'B', 'L', 'O', 'G', '1', '\0' };
+
+  enum class Kind : std::uint8_t { Define = 1, Event = 2, Clock = 3 };
+
+  // Int/UInt: 8 bytes, Double: 8, Bool/Char: 1, String: u32 length + bytes, Pointer: 8,
+  // Float: 4 (kept apart from Double so "{}" prints the shortest float representation)
+  enum class ArgTag : std::uint8_t { Int = 1, UInt, Double, Bool, Char, String, Pointer, Float };
+
+  inline std::uint64_t systemNow () {
+    return static_cast<std::uint64_t> (std::chrono::duration_cast<std::chrono::nanoseconds> (
+                                           std::chrono::system_clock::now ().time_since_epoch ())
+                                           .count ());
+  }
+
+  inline std::uint64_t steadyNow () {
+    return static_cast<std::uint64_t> (std::chrono::duration_cast<std::chrono::nanoseconds> (
+                                           std::chrono::steady_clock::now ().time_since_epoch ())
+                                           .count ());
+  }
+
+  inline std::uint64_t ticks () {
+#if defined(BINARYLOG_HAS_TSC)
+    return __rdtsc ();
+#else
+    return steadyNow ();
+#endif
+  }
+
+  template <typename T> char* put (char* out, const T& value) {
+    std::memcpy (out, &value, sizeof value);
+    return out + sizeof value;
+  }
+
+  inline char* putString (char* out, std::string_view text) {
+    out = put (out, static_cast<std::uint32_t> (text.size ()));
+    std::memcpy (out, text.data (), text.size ());
+    return out + text.size ();
+  }
+
+  template <typename T>
+  constexpr bool isStored = std::is_arithmetic_v<std::decay_t<T>>
+                            || std::is_convertible_v<const T&, std::string_view>
+                            || std::is_pointer_v<std::decay_t<T>>;
+
+  // Arguments are stored raw. Types the decoder cannot rebuild are formatted with "{}"
+  // first, the only formatting left on the logging thread.
+  template <typename T> decltype (auto) storable (const T& value) {
+    if constexpr (isStored<T>) {
+      return (value);
+    } else {
+      return fmt::format ("{}", value);
+    }
+  }
+
+  template <typename T> std::size_t argSize (const T& value) {
+    using D = std::decay_t<T>;
+    if constexpr (std::is_same_v<D, bool> || std::is_same_v<D, char>) {
+      return 2;
+    } else if constexpr (std::is_same_v<D, float>) {
+      return 1 + 4;
+    } else if constexpr (std::is_arithmetic_v<D>) {
+      return 1 + 8;
+    } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+      return 1 + 4 + std::string_view (value).size ();
+    } else {
+      return 1 + 8;
+    }
+  }
+
+  template <typename T> char* putArg (char* out, const T& value) {
+    using D = std::decay_t<T>;
+    if constexpr (std::is_same_v<D, bool>) {
+      *out++ = static_cast<char> (ArgTag::Bool);
+      *out++ = value ? 1 : 0;
+    } else if constexpr (std::is_same_v<D, char>) {
+      *out++ = static_cast<char> (ArgTag::Char);
+      *out++ = value;
+    } else if constexpr (std::is_integral_v<D> && std::is_signed_v<D>) {
+      *out++ = static_cast<char> (ArgTag::Int);
+      out = put (out, static_cast<std::int64_t> (value));
+    } else if constexpr (std::is_integral_v<D>) {
+      *out++ = static_cast<char> (ArgTag::UInt);
+      out = put (out, static_cast<std::uint64_t> (value));
+    } else if constexpr (std::is_same_v<D, float>) {
+      *out++ = static_cast<char> (ArgTag::Float);
+      out = put (out, value);
+    } else if constexpr (std::is_floating_point_v<D>) {
+      *out++ = static_cast<char> (ArgTag::Double);
+      out = put (out, static_cast<double> (value));
+    } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+      *out++ = static_cast<char> (ArgTag::String);
+      out = putString (out, std::string_view (value));
+    } else {
+      *out++ = static_cast<char> (ArgTag::Pointer);
+      out = put (out, static_cast<std::uint64_t> (reinterpret_cast<std::uintptr_t> (value)));
+    }
+    return out;
+  }
+
+} // namespace BinaryLog
+
+// Encodes records straight into a preallocated buffer and writes it out when full, on
+// flush () and on close (). A format is looked up by the address of its string literal
+// together with the caller and level, so every call site gets one Define per file. The
+// text behind both addresses is compared on every hit as well: a buffer reused for
+// another format or caller gets a new Define instead of decoding with the old one.
+class BinaryLogSink {
+public:
+  BinaryLogSink () = default;
+  BinaryLogSink (const BinaryLogSink&) = delete;
+  BinaryLogSink& operator= (const BinaryLogSink&) = delete;
+  ~BinaryLogSink () {
+    close ();
+  }
+
+  bool open (const std::string& filename, std::size_t bufferBytes) {
+    std::lock_guard<std::mutex> lock (mutex_);
+    closeLocked ();
+    file_ = std::fopen (filename.c_str (), "wb");
+    if (file_ == nullptr) {
+      return false;
+    }
+    buffer_.assign (std::max<std::size_t> (bufferBytes, 4096), 0);
+    used_ = 0;
+    ids_.clear ();
+    nextId_ = 0;
+    char* out = reserveLocked (kHeaderBytes + kClockBytes);
+    std::memcpy (out, BinaryLog::kMagic, sizeof BinaryLog::kMagic);
+    out = BinaryLog::put (out + sizeof BinaryLog::kMagic, BinaryLog::systemNow ());
+    BinaryLog::put (out, BinaryLog::steadyNow ());
+    used_ += kHeaderBytes;
+    putClockLocked ();
+    return true;
+  }
+
+  void close () {
+    std::lock_guard<std::mutex> lock (mutex_);
+    closeLocked ();
+  }
+
+  void flush () {
+    std::lock_guard<std::mutex> lock (mutex_);
+    flushLocked ();
+    if (file_ != nullptr) {
+      std::fflush (file_);
+    }
+  }
+
+  // format and caller are only read during the call
+  template <typename... Args>
+  void write (int level, const char* format, std::string_view caller, const Args&... args) {
+    static_assert (sizeof...(Args) < 256, "too many log arguments");
+    writeStored (level, format, caller, BinaryLog::storable (args)...);
+  }
+
+private:
+  static constexpr std::size_t kHeaderBytes = sizeof BinaryLog::kMagic + 8 + 8;
+  static constexpr std::size_t kClockBytes = 1 + 8 + 8;
+
+  template <typename... Args>
+  void writeStored (int level, const char* format, std::string_view caller,
+                    const Args&... args) {
+    const std::size_t bytes = 1 + 4 + 8 + 1 + (BinaryLog::argSize (args) + ... + 0);
+    std::lock_guard<std::mutex> lock (mutex_);
+    if (file_ == nullptr) {
+      return;
+    }
+    const std::uint32_t id = idLocked (level, format, caller);
+    char* out = reserveLocked (bytes);
+    // sampled under the lock, so the records of all threads are in time order, and after
+    // reserveLocked, whose flush may close the block with a later Clock record
+    const std::uint64_t now = BinaryLog::ticks ();
+    *out++ = static_cast<char> (BinaryLog::Kind::Event);
+    out = BinaryLog::put (out, id);
+    out = BinaryLog::put (out, now);
+    *out++ = static_cast<char> (sizeof...(Args));
+    ((out = BinaryLog::putArg (out, args)), ...);
+    used_ += bytes;
+  }
+
+  struct Key {
+    const char* format;
+    const char* caller;
+    std::size_t callerSize;
+    int level;
+
+    bool operator== (const Key& other) const {
+      return format == other.format && caller == other.caller
+             && callerSize == other.callerSize && level == other.level;
+    }
+  };
+
+  struct KeyHash {
+    std::size_t operator() (const Key& key) const {
+      std::size_t h = std::hash<const void*>{}(key.format);
+      h ^= std::hash<const void*>{}(key.caller) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+      return h ^ (key.callerSize << 3) ^ static_cast<std::size_t> (key.level);
+    }
+  };
+
+  struct Definition {
+    std::uint32_t id;
+    std::string format;
+    std::string caller;
+  };
+
+  std::uint32_t idLocked (int level, const char* format, std::string_view caller) {
+    const auto [it, inserted]
+        = ids_.try_emplace (Key{ format, caller.data (), caller.size (), level });
+    const std::string_view text (format);
+    Definition& definition = it->second;
+    if (!inserted && definition.format == text && definition.caller == caller) {
+      return definition.id;
+    }
+    definition = { nextId_++, std::string (text), std::string (caller) };
+
+    const std::size_t bytes = 1 + 4 + 1 + 4 + text.size () + 4 + caller.size ();
+    char* out = reserveLocked (bytes);
+    *out++ = static_cast<char> (BinaryLog::Kind::Define);
+    out = BinaryLog::put (out, definition.id);
+    *out++ = static_cast<char> (level);
+    out = BinaryLog::putString (out, text);
+    BinaryLog::putString (out, caller);
+    used_ += bytes;
+    return definition.id;
+  }
+
+  // Room for `bytes` plus the Clock record that closes the block; the caller advances used_
+  char* reserveLocked (std::size_t bytes) {
+    if (used_ + bytes + kClockBytes > buffer_.size ()) {
+      flushLocked ();
+      if (bytes + kClockBytes > buffer_.size ()) {
+        buffer_.resize (bytes + kClockBytes);
+      }
+    }
+    return buffer_.data () + used_;
+  }
+
+  void putClockLocked () {
+    char* out = buffer_.data () + used_;
+    *out++ = static_cast<char> (BinaryLog::Kind::Clock);
+    out = BinaryLog::put (out, BinaryLog::ticks ());
+    BinaryLog::put (out, BinaryLog::steadyNow ());
+    used_ += kClockBytes;
+  }
+
+  void flushLocked () {
+    if (file_ != nullptr && used_ != 0) {
+      putClockLocked ();
+      std::fwrite (buffer_.data (), 1, used_, file_);
+    }
+    used_ = 0;
+  }
+
+  void closeLocked () {
+    flushLocked ();
+    if (file_ != nullptr) {
+      std::fclose (file_);
+      file_ = nullptr;
+    }
+  }
+
+  std::mutex mutex_;
+  std::FILE* file_ = nullptr;
+  std::vector<char> buffer_;
+  std::size_t used_ = 0;
+  std::unordered_map<Key, Definition, KeyHash> ids_;
+  std::uint32_t nextId_ = 0;
+};
+
+#endif // BINARYLOGSINK_HPP
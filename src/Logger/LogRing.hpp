@@ -0,0 +1,104 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+// Bounded lock-free multi-producer / single-consumer ring for the async logger
+
+#ifndef LOGRING_HPP
+#define LOGRING_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+// Vyukov's bounded queue specialised for one consumer. Every cell carries a sequence
+// number: it equals the ticket when the cell is free for that producer and ticket + 1
+// once the value is published. Producers claim tickets with a CAS on tail_, the consumer
+// owns head_ and never touches a shared counter.
+template <typename T> class LogRing {
+public:
+  // capacity is rounded up to a power of two
+  explicit LogRing (std::size_t capacity)
+      : mask_ (roundUp (capacity) - 1), cells_ (new Cell[mask_ + 1]) {
+    for (std::size_t i = 0; i <= mask_; ++i) {
+      cells_[i].sequence.store (i, std::memory_order_relaxed);
+    }
+  }
+
+  LogRing (const LogRing&) = delete;
+  LogRing& operator= (const LogRing&) = delete;
+
+  // Any thread. Returns false without touching value when the ring is full.
+  bool tryPush (T& value) {
+    std::size_t ticket = tail_.load (std::memory_order_relaxed);
+    for (;;) {
+      Cell& cell = cells_[ticket & mask_];
+      const std::size_t sequence = cell.sequence.load (std::memory_order_acquire);
+      const auto diff = static_cast<std::intptr_t> (sequence - ticket);
+      if (diff == 0) {
+        if (tail_.compare_exchange_weak (ticket, ticket + 1, std::memory_order_relaxed)) {
+          cell.value = std::move (value);
+          cell.sequence.store (ticket + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false; // the consumer has not freed this cell yet
+      } else {
+        ticket = tail_.load (std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // Consumer thread only
+  bool tryPop (T& value) {
+    Cell& cell = cells_[head_ & mask_];
+    if (cell.sequence.load (std::memory_order_acquire) != head_ + 1) {
+      return false;
+    }
+    value = std::move (cell.value);
+    cell.sequence.store (head_ + mask_ + 1, std::memory_order_release);
+    ++head_;
+    return true;
+  }
+
+  // Consumer thread only
+  bool empty () const {
+    return cells_[head_ & mask_].sequence.load (std::memory_order_acquire) != head_ + 1;
+  }
+
+  // Tickets claimed so far, published or not; the consumer has written everything
+  // before a flush once popped () reaches this value.
+  std::size_t claimed () const {
+    return tail_.load (std::memory_order_acquire);
+  }
+
+  // Consumer thread only
+  std::size_t popped () const {
+    return head_;
+  }
+
+  std::size_t capacity () const {
+    return mask_ + 1;
+  }
+
+private:
+  struct alignas (64) Cell {
+    std::atomic<std::size_t> sequence;
+    T value;
+  };
+
+  static std::size_t roundUp (std::size_t n) {
+    std::size_t p = 2;
+    while (p < n) {
+      p <<= 1;
+    }
+    return p;
+  }
+
+  const std::size_t mask_;
+  std::unique_ptr<Cell[]> cells_;
+  alignas (64) std::atomic<std::size_t> tail_{ 0 };
+  alignas (64) std::size_t head_ = 0;
+};
+
+#endif // LOGRING_HPP
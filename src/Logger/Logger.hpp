@@ -5,7 +5,11 @@
 #ifndef LOGGER_HPP
 #define LOGGER_HPP
 
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <ctime>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -14,8 +18,11 @@
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <thread>
 
+#include "BinaryLogSink.hpp"
+#include "LogRing.hpp"
 #include "fmt/core.h"
 
 #ifdef _WIN32
@@ -60,6 +67,16 @@
   #define FUNCTION_NAME __func__
 #endif
 
+// Lowest level compiled in: 0 debug, 1 info, 2 warning, 3 error, 4 critical, 5 none.
+// Statements below it vanish from the binary; release builds drop debug by default.
+#ifndef LOGGER_MIN_LEVEL
+  #ifdef NDEBUG
+    #define LOGGER_MIN_LEVEL 1
+  #else
+    #define LOGGER_MIN_LEVEL 0
+  #endif
+#endif
+
 class Logger {
 
 private:
@@ -70,6 +87,7 @@ private:
 protected:
   Logger () = default;
   ~Logger () {
+    stopAsync ();
     std::lock_guard<std::mutex> lock (logMutex_);
     if (logFile_.is_open ()) {
       logFile_.close ();
@@ -89,61 +107,186 @@ public:
 public:
   enum class Level { LOG_DEBUG, LOG_INFO, LOG_WARNING, LOG_ERROR, LOG_CRITICAL };
 
+  // What log () does with a record when the async ring is full
+  enum class Overflow { Drop, Block };
+
 private:
-  Level currentLevel_ = Level::LOG_INFO;
+  // Runtime threshold. A static member rather than state of the instance, so the LOG_*
+  // macros test it without going through getInstance ()
+  static inline std::atomic<int> threshold_{ LOGGER_MIN_LEVEL };
+
+  struct Record {
+    Level level = Level::LOG_INFO;
+    std::chrono::system_clock::time_point time;
+    std::string caller;
+    std::string message;
+  };
+
+  // Async mode: producers push into ring_, worker_ formats and writes. producers_ counts
+  // threads inside pushAsync so stopAsync can wait them out before draining the ring.
+  std::unique_ptr<LogRing<Record>> ring_;
+  Overflow overflow_ = Overflow::Drop;
+  std::thread worker_;
+  std::mutex asyncControl_;
+  std::atomic<bool> async_{ false };
+  std::atomic<bool> stopping_{ false };
+  std::atomic<bool> workerIdle_{ false };
+  std::atomic<int> producers_{ 0 };
+  std::atomic<int> flushWaiters_{ 0 };
+  std::atomic<std::size_t> written_{ 0 };
+  std::atomic<std::uint64_t> dropped_{ 0 };
+  std::mutex wakeMutex_;
+  std::condition_variable wakeCv_;
+  std::mutex flushMutex_;
+  std::condition_variable flushCv_;
+
+  BinaryLogSink binary_;
+  std::atomic<bool> binaryEnabled_{ false };
 
 public:
-  void debug (const std::string& message, const std::string& caller = "") {
+  static bool enabled (Level level) {
+    return static_cast<int> (level) >= threshold_.load (std::memory_order_relaxed);
+  }
+
+  // Records below `level` are discarded; LOGGER_MIN_LEVEL still applies on top
+  void setLevel (Level level) {
+    threshold_.store (static_cast<int> (level), std::memory_order_relaxed);
+  }
+
+  Level getLevel () const {
+    return static_cast<Level> (threshold_.load (std::memory_order_relaxed));
+  }
+
+  void debug (const std::string& message, std::string_view caller = {}) {
     log (Level::LOG_DEBUG, message, caller);
   }
 
-  void info (const std::string& message, const std::string& caller = "") {
+  void info (const std::string& message, std::string_view caller = {}) {
     log (Level::LOG_INFO, message, caller);
   }
 
-  void warning (const std::string& message, const std::string& caller = "") {
+  void warning (const std::string& message, std::string_view caller = {}) {
     log (Level::LOG_WARNING, message, caller);
   }
 
-  void error (const std::string& message, const std::string& caller = "") {
+  void error (const std::string& message, std::string_view caller = {}) {
     log (Level::LOG_ERROR, message, caller);
   }
 
-  void critical (const std::string& message, const std::string& caller = "") {
+  void critical (const std::string& message, std::string_view caller = {}) {
     log (Level::LOG_CRITICAL, message, caller);
   }
 
-  void log (Level level, const std::string& message, const std::string& caller = "") {
-    std::lock_guard<std::mutex> lock (logMutex_);
-    auto now = std::chrono::system_clock::now ();
-    auto now_time = std::chrono::system_clock::to_time_t (now);
-    std::tm now_tm;
-#ifdef _WIN32
-    localtime_s (&now_tm, &now_time);
-#else
-    localtime_r (&now_time, &now_tm);
-#endif
-    // Výstup na konzoli
-    if (level == Level::LOG_ERROR || level == Level::LOG_CRITICAL) {
-      logToStream (std::cerr, level, message, caller, now_tm);
-    } else {
-      logToStream (std::cout, level, message, caller, now_tm);
+  void log (Level level, const std::string& message, std::string_view caller = {}) {
+    if (!enabled (level)) {
+      return;
     }
-    // Výstup do souboru, pokud je povolen
-    if (logFile_.is_open ()) {
-      logFile_ << "[" << std::put_time (&now_tm, "%d-%m-%Y %H:%M:%S") << "] ";
-      logFile_ << "[" << (caller.empty () ? "empty caller" : caller) << "] ";
-      logFile_ << "[" << levelToString (level) << "] " << message << std::endl;
+    const auto now = std::chrono::system_clock::now ();
+    if (async_.load (std::memory_order_relaxed) && pushAsync (level, now, message, caller)) {
+      return;
     }
+    std::lock_guard<std::mutex> lock (logMutex_);
+    char time[32];
+    formatTime (std::chrono::system_clock::to_time_t (now), time, sizeof time);
+    write (level, message, caller, time, true);
   }
 
   template <typename... Args>
-  void logFmtMessage (Level level, const std::string& format, const std::string& caller,
+  void logFmtMessage (Level level, const std::string& format, std::string_view caller,
                       Args&&... args) {
-    std::string message = fmt::format (format, std::forward<Args> (args)...);
+    if (!enabled (level)) {
+      return;
+    }
+    std::string message = fmt::format (fmt::runtime (format), std::forward<Args> (args)...);
+    if (binaryEnabled_.load (std::memory_order_relaxed)) {
+      // a runtime format string has no stable address, the record keeps the text
+      binary_.write (static_cast<int> (level), "{}", caller, message);
+      return;
+    }
     log (level, message, caller);
   }
 
+  // String literal formats (the LOG_*_FMT macros). With binary logging on, nothing is
+  // formatted: the format is looked up by its address, checked against its text, and the
+  // arguments are stored.
+  template <std::size_t N, typename... Args>
+  void logFmtMessage (Level level, const char (&format)[N], std::string_view caller,
+                      Args&&... args) {
+    if (!enabled (level)) {
+      return;
+    }
+    if (binaryEnabled_.load (std::memory_order_relaxed)) {
+      binary_.write (static_cast<int> (level), format, caller, args...);
+      return;
+    }
+    log (level, fmt::format (fmt::runtime (format), std::forward<Args> (args)...), caller);
+  }
+
+public:
+  // Moves formatting and I/O to a background thread: log () only copies the record into
+  // a lock-free ring of `capacity` entries. With a full ring Overflow::Drop discards the
+  // record (the writer reports how many), Overflow::Block waits for space.
+  // Returns false if async mode is already running.
+  bool startAsync (std::size_t capacity = 4096, Overflow overflow = Overflow::Drop) {
+    std::lock_guard<std::mutex> control (asyncControl_);
+    if (worker_.joinable ()) {
+      return false;
+    }
+    ring_ = std::make_unique<LogRing<Record>> (capacity);
+    overflow_ = overflow;
+    written_.store (0);
+    dropped_.store (0);
+    worker_ = std::thread ([this] { drain (); });
+    async_.store (true);
+    return true;
+  }
+
+  // Writes everything already queued, joins the writer and goes back to synchronous
+  // logging. Called by the destructor, so records queued before exit are not lost.
+  void stopAsync () {
+    std::lock_guard<std::mutex> control (asyncControl_);
+    if (!worker_.joinable ()) {
+      return;
+    }
+    async_.store (false);
+    while (producers_.load () != 0) {
+      std::this_thread::yield ();
+    }
+    stopping_.store (true);
+    wakeCv_.notify_one ();
+    worker_.join ();
+    stopping_.store (false);
+    ring_.reset ();
+  }
+
+  // Blocks until every record logged before the call has been written, then flushes
+  // the console and the log file
+  void flush () {
+    std::lock_guard<std::mutex> control (asyncControl_);
+    if (worker_.joinable ()) {
+      const std::size_t target = ring_->claimed ();
+      flushWaiters_.fetch_add (1);
+      {
+        std::unique_lock<std::mutex> lock (flushMutex_);
+        wakeCv_.notify_one ();
+        flushCv_.wait (lock, [&] { return written_.load () >= target; });
+      }
+      flushWaiters_.fetch_sub (1);
+    }
+    std::lock_guard<std::mutex> lock (logMutex_);
+    flushStreams ();
+    binary_.flush ();
+  }
+
+  bool isAsync () const {
+    return async_.load (std::memory_order_relaxed);
+  }
+
+  // Records discarded by Overflow::Drop since startAsync
+  std::uint64_t droppedCount () const {
+    return dropped_.load (std::memory_order_relaxed);
+  }
+
 public:
   bool enableFileLogging (const std::string& filename) {
     std::lock_guard<std::mutex> lock (logMutex_);
@@ -162,6 +305,20 @@ public:
     }
   }
 
+  // logFmtMessage records go to `filename` in the BinaryLogSink.hpp layout instead of the
+  // console and text file: timestamp, format id and raw arguments, formatted later by
+  // SunrisetLogDecode (tools/). Stream and plain message records are not affected.
+  bool enableBinaryLogging (const std::string& filename, std::size_t bufferBytes = 1 << 20) {
+    const bool opened = binary_.open (filename, bufferBytes);
+    binaryEnabled_.store (opened);
+    return opened;
+  }
+
+  void disableBinaryLogging () {
+    binaryEnabled_.store (false);
+    binary_.close ();
+  }
+
   void disableFileLogging () {
     std::lock_guard<std::mutex> lock (logMutex_);
     if (logFile_.is_open ()) {
@@ -186,17 +343,23 @@ public:
     }
   }
 
-  void resetConsoleColor () {
+  // The colour goes to the stream the record is written to, so records on stderr never
+  // put escapes into stdout
+  void resetConsoleColor (std::ostream& stream) {
 #ifdef _WIN32
-    SetConsoleTextAttribute (GetStdHandle (STD_OUTPUT_HANDLE),
+    SetConsoleTextAttribute (consoleHandle (stream),
                              FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_BLUE);
 #else
-    std::cout << "\033[0m";
+    stream << "\033[0m";
 #endif
   }
 
 #ifdef _WIN32
-  void setConsoleColorWindows (Level level) {
+  static HANDLE consoleHandle (const std::ostream& stream) {
+    return GetStdHandle (&stream == &std::cerr ? STD_ERROR_HANDLE : STD_OUTPUT_HANDLE);
+  }
+
+  void setConsoleColorWindows (std::ostream& stream, Level level) {
     const std::map<Level, WORD> colorMap
         = { { Level::LOG_DEBUG, FOREGROUND_BLUE | FOREGROUND_GREEN | FOREGROUND_INTENSITY },
             { Level::LOG_INFO, FOREGROUND_GREEN | FOREGROUND_INTENSITY },
@@ -205,32 +368,31 @@ public:
             { Level::LOG_CRITICAL, FOREGROUND_RED | FOREGROUND_INTENSITY | FOREGROUND_BLUE } };
     auto it = colorMap.find (level);
     if (it != colorMap.end ()) {
-      SetConsoleTextAttribute (GetStdHandle (STD_OUTPUT_HANDLE), it->second);
+      SetConsoleTextAttribute (consoleHandle (stream), it->second);
     } else {
-      resetConsoleColor ();
+      resetConsoleColor (stream);
     }
   }
 #else
-  void setConsoleColorUnix (Level level) {
-    static const std::map<Level, const char*> colorMap = { { Level::LOG_DEBUG, "\033[34m" },
-                                                           { Level::LOG_INFO, "\033[32m" },
-                                                           { Level::LOG_WARNING, "\033[33m" },
-                                                           { Level::LOG_ERROR, "\033[31m" },
-                                                           { Level::LOG_CRITICAL, "\033[95m" } };
-    auto it = colorMap.find (level);
-    if (it != colorMap.end ()) {
-      std::cout << it->second;
+  void setConsoleColorUnix (std::ostream& stream, Level level) {
+    // a plain array rather than a static map: the async writer still colours records
+    // while function-local statics are being destroyed at exit
+    static constexpr const char* colors[] = { "\033[34m", "\033[32m", "\033[33m", "\033[31m",
+                                              "\033[95m" };
+    const auto index = static_cast<std::size_t> (level);
+    if (index < sizeof colors / sizeof colors[0]) {
+      stream << colors[index];
     } else {
-      resetConsoleColor ();
+      resetConsoleColor (stream);
     }
   }
 #endif
 
-  void setConsoleColor (Level level) {
+  void setConsoleColor (std::ostream& stream, Level level) {
 #ifdef _WIN32
-    setConsoleColorWindows (level);
+    setConsoleColorWindows (stream, level);
 #else
-    setConsoleColorUnix (level);
+    setConsoleColorUnix (stream, level);
 #endif
   }
 
@@ -240,30 +402,162 @@ private:
   bool includeTime_ = true;
   bool includeCaller_ = true;
   bool includeLevel_ = true;
+  bool consoleColor_ = true;
+
+  static void formatTime (std::time_t seconds, char* text, std::size_t size) {
+    std::tm now_tm;
+#ifdef _WIN32
+    localtime_s (&now_tm, &seconds);
+#else
+    localtime_r (&seconds, &now_tm);
+#endif
+    std::strftime (text, size, "%d-%m-%Y %H:%M:%S", &now_tm);
+  }
+
+  // Caller holds logMutex_. Synchronous records are flushed line by line, the async
+  // writer flushes once per drained batch.
+  void write (Level level, const std::string& message, std::string_view caller,
+              const char* time, bool flushLine) {
+    // Výstup na konzoli
+    if (level == Level::LOG_ERROR || level == Level::LOG_CRITICAL) {
+      logToStream (std::cerr, level, message, caller, time, flushLine);
+    } else {
+      logToStream (std::cout, level, message, caller, time, flushLine);
+    }
+    // Výstup do souboru, pokud je povolen
+    if (logFile_.is_open ()) {
+      logFile_ << "[" << time << "] ";
+      logFile_ << "[" << (caller.empty () ? std::string_view ("empty caller") : caller) << "] ";
+      logFile_ << "[" << levelToString (level) << "] " << message << '\n';
+      if (flushLine) {
+        logFile_.flush ();
+      }
+    }
+  }
+
+  void flushStreams () {
+    std::cout.flush ();
+    std::cerr.flush ();
+    if (logFile_.is_open ()) {
+      logFile_.flush ();
+    }
+  }
 
   void logToStream (std::ostream& stream, Level level, const std::string& message,
-                    const std::string& caller, const std::tm& now_tm) {
-    setConsoleColor (level);
-    stream << buildHeader (now_tm, caller, level) << message;
-    resetConsoleColor ();
-    stream << std::endl; // přidání nového řádku
+                    std::string_view caller, const char* time, bool flushLine) {
+    if (consoleColor_) {
+      setConsoleColor (stream, level);
+    }
+    stream << buildHeader (time, caller, level) << message;
+    if (consoleColor_) {
+      resetConsoleColor (stream);
+    }
+    stream << '\n'; // přidání nového řádku
+    if (flushLine) {
+      stream.flush ();
+    }
   }
 
-  std::string buildHeader (const std::tm& now_tm, const std::string& caller, Level level) const {
-    std::ostringstream header;
+  std::string buildHeader (const char* time, std::string_view caller, Level level) const {
+    std::string header;
     if (includeName_) {
-      header << "[" << headerName_ << "] ";
+      header.append ("[").append (headerName_).append ("] ");
     }
     if (includeTime_) {
-      header << "[" << std::put_time (&now_tm, "%d-%m-%Y %H:%M:%S") << "] ";
+      header.append ("[").append (time).append ("] ");
     }
     if (includeCaller_ && !caller.empty ()) {
-      header << "[" << caller << "] ";
+      header.append ("[").append (caller).append ("] ");
     }
     if (includeLevel_) {
-      header << "[" << levelToString (level) << "] ";
+      header.append ("[").append (levelToString (level)).append ("] ");
     }
-    return header.str ();
+    return header;
+  }
+
+  // Returns false when async mode was stopped meanwhile; the caller then logs
+  // synchronously. The seq_cst pair producers_ / async_ is what stopAsync relies on.
+  bool pushAsync (Level level, std::chrono::system_clock::time_point time,
+                  const std::string& message, std::string_view caller) {
+    producers_.fetch_add (1);
+    const bool accepted = async_.load ();
+    if (accepted) {
+      Record record{ level, time, std::string (caller), message };
+      bool pushed = ring_->tryPush (record);
+      if (!pushed && overflow_ == Overflow::Block) {
+        while (!(pushed = ring_->tryPush (record))) {
+          wakeCv_.notify_one ();
+          std::this_thread::yield ();
+        }
+      }
+      if (!pushed) {
+        dropped_.fetch_add (1, std::memory_order_relaxed);
+      } else if (workerIdle_.load ()) {
+        wakeCv_.notify_one ();
+      }
+    }
+    producers_.fetch_sub (1, std::memory_order_release);
+    return accepted;
+  }
+
+  // The async writer thread. Holds logMutex_ for at most kBatch records at a time so the
+  // header setters and enableFileLogging are never starved.
+  void drain () {
+    constexpr int kBatch = 256;
+    Record record;
+    std::uint64_t reportedDrops = 0;
+    std::time_t cachedSecond = -1;
+    char time[32] = "";
+    for (;;) {
+      bool wrote = false;
+      {
+        std::lock_guard<std::mutex> lock (logMutex_);
+        for (int n = 0; n < kBatch && ring_->tryPop (record); ++n) {
+          const std::time_t seconds = std::chrono::system_clock::to_time_t (record.time);
+          if (seconds != cachedSecond) {
+            formatTime (seconds, time, sizeof time);
+            cachedSecond = seconds;
+          }
+          write (record.level, record.message, record.caller, time, false);
+          wrote = true;
+        }
+        const std::uint64_t drops = dropped_.load (std::memory_order_relaxed);
+        if (drops != reportedDrops) {
+          formatTime (std::time (nullptr), time, sizeof time);
+          cachedSecond = -1;
+          write (Level::LOG_WARNING,
+                 std::to_string (drops - reportedDrops) + " records dropped, log queue full",
+                 "Logger", time, false);
+          reportedDrops = drops;
+          wrote = true;
+        }
+        if (wrote && ring_->empty ()) {
+          flushStreams ();
+        }
+      }
+      if (wrote) {
+        written_.store (ring_->popped ());
+        if (flushWaiters_.load () != 0) {
+          // taking the mutex orders the notify after the waiter's predicate check
+          std::lock_guard<std::mutex> lock (flushMutex_);
+          flushCv_.notify_all ();
+        }
+        continue;
+      }
+      // Nothing published: either idle or a producer sits between its CAS and publish.
+      // After stopAsync no producer is left, so an empty ring means done.
+      if (stopping_.load () && ring_->empty ()) {
+        break;
+      }
+      workerIdle_.store (true);
+      if (ring_->empty () && !stopping_.load ()) {
+        std::unique_lock<std::mutex> lock (wakeMutex_);
+        wakeCv_.wait_for (lock, std::chrono::milliseconds (10));
+      }
+      workerIdle_.store (false);
+    }
+    std::lock_guard<std::mutex> lock (logMutex_);
+    flushStreams ();
   }
 
 public:
@@ -288,6 +582,11 @@ public:
     std::lock_guard<std::mutex> lock (logMutex_);
     includeLevel_ = includeLevel;
   }
+  // Off when the console output is data (a pipe or a file) rather than a terminal
+  void showConsoleColor (bool consoleColor) {
+    std::lock_guard<std::mutex> lock (logMutex_);
+    consoleColor_ = consoleColor;
+  }
   void noHeader (bool noHeader) {
     if (noHeader) {
       showHeaderName (false);
@@ -311,7 +610,7 @@ public:
 public:
   class LogStream {
   public:
-    LogStream (Logger& logger, Level level, const std::string& caller)
+    LogStream (Logger& logger, Level level, std::string_view caller)
         : logger_ (logger), level_ (level), caller_ (caller) {
     }
     ~LogStream () {
@@ -331,12 +630,13 @@ public:
   private:
     Logger& logger_;
     Level level_;
-    std::string caller_;
+    std::string_view caller_;
     std::ostringstream oss_;
   };
 
   // Metoda, která vrací objekt LogStream pro streamové logování
-  LogStream stream (Level level, const std::string& caller = "") {
+  // caller must outlive the returned stream (FUNCTION_NAME in the macros)
+  LogStream stream (Level level, std::string_view caller = {}) {
     return LogStream (*this, level, caller);
   }
 }; // class Logger
@@ -344,33 +644,32 @@ public:
 // clang-format off
   #define LOG Logger::getInstance()
 
-#ifndef NDEBUG
-  #define LOG_D_STREAM Logger::getInstance().stream(Logger::Level::LOG_DEBUG, FUNCTION_NAME)
-  #define LOG_D_MSG(msg) Logger::getInstance().debug(msg, FUNCTION_NAME)
-  #define LOG_D_FMT(format, ...) Logger::getInstance().logFmtMessage(Logger::Level::LOG_DEBUG, format, FUNCTION_NAME, __VA_ARGS__)
-#else
-  #define LOG_D_STREAM if(0) Logger::getInstance().stream(Logger::Level::LOG_DEBUG, FUNCTION_NAME)
-  #define LOG_D_MSG(msg) do {} while(0)
-  #define LOG_D_FMT(format, ...) do {} while(0)
-#endif
-  
-  //#define LOG_D_STREAM Logger::getInstance().stream(Logger::Level::LOG_DEBUG, FUNCTION_NAME)
-  #define LOG_I_STREAM Logger::getInstance().stream(Logger::Level::LOG_INFO, FUNCTION_NAME)
-  #define LOG_W_STREAM Logger::getInstance().stream(Logger::Level::LOG_WARNING, FUNCTION_NAME)
-  #define LOG_E_STREAM Logger::getInstance().stream(Logger::Level::LOG_ERROR, FUNCTION_NAME)
-  #define LOG_C_STREAM Logger::getInstance().stream(Logger::Level::LOG_CRITICAL, FUNCTION_NAME)
-  
-  //#define LOG_D_MSG(msg) Logger::getInstance().debug(msg, FUNCTION_NAME)
-  #define LOG_I_MSG(msg) Logger::getInstance().info(msg, FUNCTION_NAME)
-  #define LOG_W_MSG(msg) Logger::getInstance().warning(msg, FUNCTION_NAME)
-  #define LOG_E_MSG(msg) Logger::getInstance().error(msg, FUNCTION_NAME)
-  #define LOG_C_MSG(msg) Logger::getInstance().critical(msg, FUNCTION_NAME)
-  
-  //#define LOG_D_FMT(format, ...) Logger::getInstance().logFmtMessage(Logger::Level::LOG_DEBUG, format, FUNCTION_NAME, __VA_ARGS__)
-  #define LOG_I_FMT(format, ...) Logger::getInstance().logFmtMessage(Logger::Level::LOG_INFO, format, FUNCTION_NAME, __VA_ARGS__)
-  #define LOG_W_FMT(format, ...) Logger::getInstance().logFmtMessage(Logger::Level::LOG_WARNING, format, FUNCTION_NAME, __VA_ARGS__)
-  #define LOG_E_FMT(format, ...) Logger::getInstance().logFmtMessage(Logger::Level::LOG_ERROR, format, FUNCTION_NAME, __VA_ARGS__)
-  #define LOG_C_FMT(format, ...) Logger::getInstance().logFmtMessage(Logger::Level::LOG_CRITICAL, format, FUNCTION_NAME, __VA_ARGS__)
+  // The first operand is a constant, so statements below LOGGER_MIN_LEVEL compile away;
+  // otherwise a disabled statement costs one relaxed load and a branch. The
+  // `if (!on) ; else` form skips evaluating the streamed / formatted arguments and stays
+  // a single statement (no dangling else).
+  #define LOG_ENABLED(level) (static_cast<int>(level) >= LOGGER_MIN_LEVEL && Logger::enabled(level))
+  #define LOG_STREAM_AT(level) if (!LOG_ENABLED(level)) ; else Logger::getInstance().stream(level, FUNCTION_NAME)
+  #define LOG_MSG_AT(level, msg) if (!LOG_ENABLED(level)) ; else Logger::getInstance().log(level, msg, FUNCTION_NAME)
+  #define LOG_FMT_AT(level, format, ...) if (!LOG_ENABLED(level)) ; else Logger::getInstance().logFmtMessage(level, format, FUNCTION_NAME, __VA_ARGS__)
+
+  #define LOG_D_STREAM LOG_STREAM_AT(Logger::Level::LOG_DEBUG)
+  #define LOG_I_STREAM LOG_STREAM_AT(Logger::Level::LOG_INFO)
+  #define LOG_W_STREAM LOG_STREAM_AT(Logger::Level::LOG_WARNING)
+  #define LOG_E_STREAM LOG_STREAM_AT(Logger::Level::LOG_ERROR)
+  #define LOG_C_STREAM LOG_STREAM_AT(Logger::Level::LOG_CRITICAL)
+
+  #define LOG_D_MSG(msg) LOG_MSG_AT(Logger::Level::LOG_DEBUG, msg)
+  #define LOG_I_MSG(msg) LOG_MSG_AT(Logger::Level::LOG_INFO, msg)
+  #define LOG_W_MSG(msg) LOG_MSG_AT(Logger::Level::LOG_WARNING, msg)
+  #define LOG_E_MSG(msg) LOG_MSG_AT(Logger::Level::LOG_ERROR, msg)
+  #define LOG_C_MSG(msg) LOG_MSG_AT(Logger::Level::LOG_CRITICAL, msg)
+
+  #define LOG_D_FMT(format, ...) LOG_FMT_AT(Logger::Level::LOG_DEBUG, format, __VA_ARGS__)
+  #define LOG_I_FMT(format, ...) LOG_FMT_AT(Logger::Level::LOG_INFO, format, __VA_ARGS__)
+  #define LOG_W_FMT(format, ...) LOG_FMT_AT(Logger::Level::LOG_WARNING, format, __VA_ARGS__)
+  #define LOG_E_FMT(format, ...) LOG_FMT_AT(Logger::Level::LOG_ERROR, format, __VA_ARGS__)
+  #define LOG_C_FMT(format, ...) LOG_FMT_AT(Logger::Level::LOG_CRITICAL, format, __VA_ARGS__)
 // clang-format on
 
 #endif // LOGGER_HPP
\ No newline at end of file
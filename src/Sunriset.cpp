@@ -3,6 +3,9 @@
 
 #include <Logger/Logger.hpp>
 #include <Utils/Utils.hpp>
+#include <Sunriset/ChebyshevEphemeris.hpp>
+#include <Sunriset/ResultCache.hpp>
+#include <Sunriset/SolarTable.hpp>
 #include <Sunriset/Sunriset.hpp>
 
 namespace dotname {
@@ -37,6 +40,74 @@ namespace dotname {
     LOG_I_STREAM << "Sunrise: " << doubleTo24Time (rise) << " "
                  << "Sunset: " << doubleTo24Time (set) << std::endl;
   }
+  // libName is the same for every instance, so the assignments leave it alone
+  Sunriset::Sunriset (const Sunriset& other) = default;
+  Sunriset::Sunriset (Sunriset&& other) noexcept = default;
+
+  Sunriset& Sunriset::operator= (const Sunriset& other) {
+    assetsPath_ = other.assetsPath_;
+    table_ = other.table_;
+    cache_ = other.cache_;
+    chebyshev_ = other.chebyshev_;
+    return *this;
+  }
+
+  Sunriset& Sunriset::operator= (Sunriset&& other) noexcept {
+    assetsPath_ = std::move (other.assetsPath_);
+    table_ = std::move (other.table_);
+    cache_ = std::move (other.cache_);
+    chebyshev_ = std::move (other.chebyshev_);
+    return *this;
+  }
+
+  int Sunriset::getSunrisetRouted (int year, int month, int day, double lon, double lat,
+                                   double& rise, double& set) const {
+    if (cache_) {
+      return cache_->getSunriset (year, month, day, lon, lat, rise, set);
+    }
+    return chebyshev_->sunriset (year, month, day, lon, lat, -35.0 / 60.0, 1, rise, set);
+  }
+
+  void Sunriset::setCache (std::shared_ptr<ResultCache> cache) {
+    cache_ = std::move (cache);
+    if (cache_) {
+      LOG_D_STREAM << "Result cache: " << cache_->stats ().capacity << " entries, "
+                   << cache_->gridDegrees () << " degree grid, " << cache_->shardCount ()
+                   << " shards" << std::endl;
+    }
+  }
+
+  void Sunriset::setEphemerisModel (EphemerisModel model) {
+    if (model == EphemerisModel::Exact) {
+      chebyshev_.reset ();
+      return;
+    }
+    if (!chebyshev_) {
+      auto ephemeris = std::make_shared<const ChebyshevEphemeris> ();
+      LOG_D_STREAM << "Chebyshev ephemeris: " << ephemeris->segmentCount ()
+                   << " segments, tsouth within " << ephemeris->errorBudget ().tsouthSeconds
+                   << " s" << std::endl;
+      chebyshev_ = std::move (ephemeris);
+    }
+  }
+
+  EphemerisModel Sunriset::getEphemerisModel () const {
+    return chebyshev_ ? EphemerisModel::Chebyshev : EphemerisModel::Exact;
+  }
+
+  bool Sunriset::openTable (const std::filesystem::path& fileName) {
+    const std::filesystem::path filePath
+        = fileName.is_relative () && !assetsPath_.empty () ? assetsPath_ / fileName : fileName;
+    auto table = std::make_shared<SolarTable> ();
+    if (!table->open (filePath)) {
+      return false;
+    }
+    LOG_D_STREAM << "Solar table " << filePath << ": " << table->siteCount () << " sites x "
+                 << table->dayCount () << " days" << std::endl;
+    table_ = std::move (table);
+    return true;
+  }
+
   Sunriset::~Sunriset () {
     LOG_D_STREAM << libName << " ...destructed" << std::endl;
   }
@@ -0,0 +1,39 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <Sunriset/Batch.hpp>
+#include <Sunriset/SolarCore.hpp>
+
+namespace dotname {
+
+  void sunrisetBatch (int year, int month, int day, const double* lon, const double* lat,
+                      std::size_t count, double* rise, double* set, std::int8_t* status,
+                      SolarEvent event) {
+    const long days = core::daysSince2000Jan0 (year, month, day);
+    const SolarEventParams params = solarEventParams (event);
+
+    for (std::size_t i = 0; i < count; ++i) {
+      const core::RiseSet rs
+          = core::sunriset (days, lon[i], lat[i], params.altit, params.upperLimb);
+      rise[i] = rs.rise;
+      set[i] = rs.set;
+      if (status)
+        status[i] = static_cast<std::int8_t> (rs.rc);
+    }
+  }
+
+  void sunrisetRange (int year, int month, int day, std::size_t dayCount, double lon, double lat,
+                      double* rise, double* set, std::int8_t* status, SolarEvent event) {
+    long days = core::daysSince2000Jan0 (year, month, day);
+    const SolarEventParams params = solarEventParams (event);
+
+    for (std::size_t i = 0; i < dayCount; ++i, days = core::nextDay (days)) {
+      const core::RiseSet rs = core::sunriset (days, lon, lat, params.altit, params.upperLimb);
+      rise[i] = rs.rise;
+      set[i] = rs.set;
+      if (status)
+        status[i] = static_cast<std::int8_t> (rs.rc);
+    }
+  }
+
+} // namespace dotname
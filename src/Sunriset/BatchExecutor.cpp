@@ -0,0 +1,259 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <Sunriset/BatchExecutor.hpp>
+#include <Sunriset/SolarCore.hpp>
+
+#include "Sunriset/GridPlan.hpp"
+#include "Sunriset/Simd/SunrisetKernel.hpp"
+
+#include <algorithm>
+
+namespace dotname {
+
+  namespace {
+
+    constexpr std::size_t kTileObservers = 1024; // 16 KB of lon/lat
+    constexpr std::size_t kTileDays = 16;
+    constexpr std::size_t kGridColumnTile = 256;
+    constexpr std::size_t kGridTileCells = 64 * 1024;
+
+    std::size_t ceilDiv (std::size_t a, std::size_t b) {
+      return (a + b - 1) / b;
+    }
+
+    std::vector<long> dayNumbers (int year, int month, int day, std::size_t dayCount) {
+      std::vector<long> days (dayCount);
+      long d = core::daysSince2000Jan0 (year, month, day);
+      for (std::size_t i = 0; i < dayCount; ++i, d = core::nextDay (d))
+        days[i] = d;
+      return days;
+    }
+
+  } // namespace
+
+  // Tiles [begin, end) still owed by one thread; padded so neighbours do not share a line
+  struct alignas (64) BatchExecutor::Share {
+    std::mutex mutex;
+    std::size_t begin = 0;
+    std::size_t end = 0;
+  };
+
+  BatchExecutor::BatchExecutor (unsigned threadCount)
+      : threadCount_ (threadCount ? threadCount
+                                  : std::max (1u, std::thread::hardware_concurrency ())),
+        shares_ (new Share[threadCount_]) {
+    workers_.reserve (threadCount_ - 1);
+    for (unsigned i = 1; i < threadCount_; ++i)
+      workers_.emplace_back (&BatchExecutor::workerLoop, this, i);
+  }
+
+  BatchExecutor::~BatchExecutor () {
+    {
+      std::lock_guard<std::mutex> lock (stateMutex_);
+      stop_ = true;
+    }
+    wakeCv_.notify_all ();
+    for (auto& worker : workers_)
+      worker.join ();
+  }
+
+  void BatchExecutor::workerLoop (unsigned self) {
+    std::uint64_t seen = 0;
+    for (;;) {
+      {
+        std::unique_lock<std::mutex> lock (stateMutex_);
+        wakeCv_.wait (lock, [&] { return stop_ || generation_ != seen; });
+        if (stop_)
+          return;
+        seen = generation_;
+      }
+      drain (self);
+    }
+  }
+
+  void BatchExecutor::drain (unsigned self) {
+    std::size_t tile;
+    while (popLocal (self, tile) || steal (self, tile))
+      run (tile);
+  }
+
+  bool BatchExecutor::popLocal (unsigned self, std::size_t& tile) {
+    Share& own = shares_[self];
+    std::lock_guard<std::mutex> lock (own.mutex);
+    if (own.begin == own.end)
+      return false;
+    tile = own.begin++;
+    return true;
+  }
+
+  bool BatchExecutor::steal (unsigned self, std::size_t& tile) {
+    for (unsigned k = 1; k < threadCount_; ++k) {
+      Share& victim = shares_[(self + k) % threadCount_];
+      std::size_t begin, end;
+      {
+        std::lock_guard<std::mutex> lock (victim.mutex);
+        const std::size_t left = victim.end - victim.begin;
+        if (left == 0)
+          continue;
+        // Take the upper half, the victim keeps the tiles next to the ones it is running
+        begin = victim.begin + left / 2;
+        end = victim.end;
+        victim.end = begin;
+      }
+      steals_.fetch_add (1, std::memory_order_relaxed);
+      tile = begin;
+      Share& own = shares_[self];
+      std::lock_guard<std::mutex> lock (own.mutex);
+      own.begin = begin + 1;
+      own.end = end;
+      return true;
+    }
+    return false;
+  }
+
+  void BatchExecutor::run (std::size_t tile) {
+    try {
+      (*task_) (tile);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock (errorMutex_);
+      if (!error_)
+        error_ = std::current_exception ();
+    }
+    if (pending_.fetch_sub (1, std::memory_order_acq_rel) == 1) {
+      std::lock_guard<std::mutex> lock (stateMutex_);
+      doneCv_.notify_all ();
+    }
+  }
+
+  void BatchExecutor::parallelFor (std::size_t tileCount,
+                                   const std::function<void (std::size_t)>& task) {
+    if (tileCount == 0)
+      return;
+
+    std::lock_guard<std::mutex> submit (submitMutex_);
+    if (threadCount_ == 1 || tileCount == 1) {
+      // Same contract as the pool: every tile runs, the first exception comes out at the end
+      std::exception_ptr error;
+      for (std::size_t i = 0; i < tileCount; ++i) {
+        try {
+          task (i);
+        } catch (...) {
+          if (!error)
+            error = std::current_exception ();
+        }
+      }
+      if (error)
+        std::rethrow_exception (error);
+      return;
+    }
+
+    task_ = &task;
+    error_ = nullptr;
+    pending_.store (tileCount, std::memory_order_relaxed);
+    for (unsigned i = 0; i < threadCount_; ++i) {
+      std::lock_guard<std::mutex> lock (shares_[i].mutex);
+      shares_[i].begin = tileCount * i / threadCount_;
+      shares_[i].end = tileCount * (i + 1) / threadCount_;
+    }
+    {
+      std::lock_guard<std::mutex> lock (stateMutex_);
+      ++generation_;
+    }
+    wakeCv_.notify_all ();
+
+    drain (0);
+    {
+      std::unique_lock<std::mutex> lock (stateMutex_);
+      doneCv_.wait (lock, [&] { return pending_.load (std::memory_order_acquire) == 0; });
+    }
+    task_ = nullptr;
+    if (error_)
+      std::rethrow_exception (error_);
+  }
+
+  void BatchExecutor::sunriset (int year, int month, int day, std::size_t dayCount,
+                                const double* lon, const double* lat, std::size_t count,
+                                double* rise, double* set, std::int8_t* status,
+                                SolarEvent event, SimdLevel level) {
+    if (dayCount == 0 || count == 0)
+      return;
+
+    const std::vector<long> days = dayNumbers (year, month, day, dayCount);
+    const SolarEventParams params = solarEventParams (event);
+    const std::size_t observerTiles = ceilDiv (count, kTileObservers);
+
+    parallelFor (ceilDiv (dayCount, kTileDays) * observerTiles, [&] (std::size_t tile) {
+      const std::size_t first = (tile % observerTiles) * kTileObservers;
+      const std::size_t n = std::min (kTileObservers, count - first);
+      const std::size_t dayEnd = std::min (dayCount, (tile / observerTiles + 1) * kTileDays);
+
+      for (std::size_t k = (tile / observerTiles) * kTileDays; k < dayEnd; ++k) {
+        const std::size_t at = k * count + first;
+        if (level != SimdLevel::Scalar) {
+          simd::SunrisetKernelArgs args;
+          args.days = days[k];
+          args.dayStep = 0.0;
+          args.lon = lon + first;
+          args.lat = lat + first;
+          args.broadcastLocation = false;
+          args.rise = rise + at;
+          args.set = set + at;
+          args.status = status ? status + at : nullptr;
+          args.count = n;
+          if (simd::runSunrisetKernel (level, args, event))
+            continue;
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+          const core::RiseSet rs = core::sunriset (days[k], lon[first + i], lat[first + i],
+                                                   params.altit, params.upperLimb);
+          rise[at + i] = rs.rise;
+          set[at + i] = rs.set;
+          if (status)
+            status[at + i] = static_cast<std::int8_t> (rs.rc);
+        }
+      }
+    });
+  }
+
+  void BatchExecutor::daylen (int year, int month, int day, std::size_t dayCount,
+                              const double* lon, const double* lat, std::size_t count,
+                              double* length, SolarEvent event) {
+    if (dayCount == 0 || count == 0)
+      return;
+
+    const std::vector<long> days = dayNumbers (year, month, day, dayCount);
+    const SolarEventParams params = dayLengthParams (event);
+    const std::size_t observerTiles = ceilDiv (count, kTileObservers);
+
+    parallelFor (ceilDiv (dayCount, kTileDays) * observerTiles, [&] (std::size_t tile) {
+      const std::size_t first = (tile % observerTiles) * kTileObservers;
+      const std::size_t last = std::min (count, first + kTileObservers);
+      const std::size_t dayEnd = std::min (dayCount, (tile / observerTiles + 1) * kTileDays);
+
+      for (std::size_t k = (tile / observerTiles) * kTileDays; k < dayEnd; ++k)
+        for (std::size_t i = first; i < last; ++i)
+          length[k * count + i]
+              = core::daylen (days[k], lon[i], lat[i], params.altit, params.upperLimb);
+    });
+  }
+
+  void BatchExecutor::sunrisetGrid (int year, int month, int day, const GridSpec& grid,
+                                    const GridOptions& options, double* rise, double* set,
+                                    double* dayLength, std::int8_t* status) {
+    if (grid.nLat == 0 || grid.nLon == 0)
+      return;
+
+    grid::GridPlan plan (year, month, day, grid, options, rise, set, dayLength, status);
+    parallelFor (ceilDiv (grid.nLon, kGridColumnTile), [&] (std::size_t tile) {
+      plan.prepareColumns (tile * kGridColumnTile,
+                           std::min (grid.nLon, (tile + 1) * kGridColumnTile));
+    });
+
+    const std::size_t rows = std::max<std::size_t> (1, kGridTileCells / grid.nLon);
+    parallelFor (ceilDiv (grid.nLat, rows), [&] (std::size_t tile) {
+      plan.fillRows (tile * rows, std::min (grid.nLat, (tile + 1) * rows));
+    });
+  }
+
+} // namespace dotname
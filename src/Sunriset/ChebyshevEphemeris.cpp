@@ -0,0 +1,186 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <Logger/Logger.hpp>
+#include <Sunriset/ChebyshevEphemeris.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace dotname {
+
+  namespace {
+
+    // Range of d reachable from 1801-01-01 .. 2099-12-31 with the -lon/360 shift
+    constexpr double kFirstD = core::daysSince2000Jan0 (1801, 1, 1) - 1.0;
+    constexpr double kLastD = core::daysSince2000Jan0 (2099, 12, 31) + 2.0;
+
+    constexpr double kPi = 3.1415926535897932384;
+    constexpr int kDefaultSegmentDays = 32;
+    constexpr int kDefaultDegree = 10;
+    constexpr int kMaxDegree = 20;
+    // Terms fitted past the degree, for the truncation estimate
+    constexpr int kExtraTerms = 3;
+
+    double eqOfTime (double d, const core::SunEquatorial& sun) {
+      return core::rev180 (sun.ra - (core::gmst0 (d) - 180.0));
+    }
+
+  } // namespace
+
+  ChebyshevEphemeris::ChebyshevEphemeris (int segmentDays, int degree)
+      : segmentDays_ (segmentDays), degree_ (degree) {
+    if (segmentDays_ < 1 || segmentDays_ > 366) {
+      LOG_E_STREAM << "ChebyshevEphemeris: segment of " << segmentDays_ << " days, using "
+                   << kDefaultSegmentDays << std::endl;
+      segmentDays_ = kDefaultSegmentDays;
+    }
+    if (degree_ < 1 || degree_ > kMaxDegree) {
+      LOG_E_STREAM << "ChebyshevEphemeris: degree " << degree_ << ", using " << kDefaultDegree
+                   << std::endl;
+      degree_ = kDefaultDegree;
+    }
+    inverseSegment_ = 1.0 / segmentDays_;
+    segmentCount_ = static_cast<std::size_t> (std::ceil ((kLastD - kFirstD) / segmentDays_));
+    coefficients_.resize (segmentCount_ * kQuantities * (degree_ + 1));
+
+    // cos (pi j (k + 1/2) / nodes): the node positions (j = 1) and the Chebyshev
+    // polynomials at the nodes, the same for every segment
+    const int nodes = degree_ + 1 + kExtraTerms;
+    std::vector<double> basis (static_cast<std::size_t> (nodes * nodes));
+    for (int j = 0; j < nodes; ++j)
+      for (int k = 0; k < nodes; ++k)
+        basis[j * nodes + k] = std::cos (kPi * j * (k + 0.5) / nodes);
+    for (std::size_t i = 0; i < segmentCount_; ++i)
+      fitSegment (i, basis.data ());
+    budget_.tsouthSeconds = budget_.eqOfTime * 240.0;
+  }
+
+  void ChebyshevEphemeris::fitSegment (std::size_t index, const double* basis) {
+    const int terms = degree_ + 1;
+    const int nodes = terms + kExtraTerms;
+    const double half = 0.5 * segmentDays_;
+    const double mid = kFirstD + static_cast<double> (index) * segmentDays_ + half;
+
+    double values[kQuantities][kMaxDegree + 1 + kExtraTerms];
+    for (int k = 0; k < nodes; ++k) {
+      const double d = mid + half * basis[nodes + k];
+      const core::SunEquatorial sun = core::sunRaDec (d);
+      values[0][k] = core::sind (sun.dec);
+      values[1][k] = sun.r;
+      values[2][k] = eqOfTime (d, sun);
+    }
+
+    double* budget[kQuantities] = { &budget_.sinDec, &budget_.r, &budget_.eqOfTime };
+    for (int q = 0; q < kQuantities; ++q) {
+      // Chebyshev coefficients of the interpolant through the nodes
+      double cheb[kMaxDegree + 1 + kExtraTerms];
+      for (int j = 0; j < nodes; ++j) {
+        double sum = 0.0;
+        for (int k = 0; k < nodes; ++k)
+          sum += values[q][k] * basis[j * nodes + k];
+        cheb[j] = (j == 0 ? 1.0 : 2.0) * sum / nodes;
+      }
+      double truncated = 0.0;
+      for (int j = terms; j < nodes; ++j)
+        truncated += std::fabs (cheb[j]);
+      *budget[q] = std::max (*budget[q], truncated);
+
+      // Power series in x: sum of cheb[j] T_j (x), with T_{j+1} = 2x T_j - T_{j-1}
+      double power[kMaxDegree + 1] = {};
+      double tPrev[kMaxDegree + 1] = { 1.0 };
+      double t[kMaxDegree + 1] = { 0.0, 1.0 };
+      power[0] = cheb[0];
+      for (int j = 1; j < terms; ++j) {
+        for (int i = 0; i <= j; ++i)
+          power[i] += cheb[j] * t[i];
+        if (j + 1 == terms)
+          break;
+        double next[kMaxDegree + 1] = {};
+        for (int i = 0; i <= j; ++i)
+          next[i + 1] = 2.0 * t[i];
+        for (int i = 0; i <= j; ++i)
+          next[i] -= tPrev[i];
+        std::copy (t, t + kMaxDegree + 1, tPrev);
+        std::copy (next, next + kMaxDegree + 1, t);
+      }
+
+      double* out = coefficients_.data () + index * kQuantities * terms + q;
+      for (int i = 0; i < terms; ++i)
+        out[i * kQuantities] = power[degree_ - i];
+    }
+  }
+
+  ChebyshevEphemeris::Sample ChebyshevEphemeris::at (double d) const {
+    if (!(d >= kFirstD && d < kLastD)) {
+      const core::SunEquatorial sun = core::sunRaDec (d);
+      return { core::sind (sun.dec), core::cosd (sun.dec), sun.r, eqOfTime (d, sun) };
+    }
+
+    const double u = (d - kFirstD) * inverseSegment_;
+    const std::size_t index = std::min (static_cast<std::size_t> (u), segmentCount_ - 1);
+    const double x = 2.0 * (u - static_cast<double> (index)) - 1.0;
+    const int terms = degree_ + 1;
+    const double* c = coefficients_.data () + index * kQuantities * terms;
+
+    // The three Horner chains advance together, so their latencies overlap
+    double sinDec = c[0], r = c[1], eqOfTime = c[2];
+    for (int i = 1; i < terms; ++i) {
+      c += kQuantities;
+      sinDec = sinDec * x + c[0];
+      r = r * x + c[1];
+      eqOfTime = eqOfTime * x + c[2];
+    }
+    return { sinDec, std::sqrt (1.0 - sinDec * sinDec), r, eqOfTime };
+  }
+
+  // sidtime - RA = GMST0 + 180 + lon - RA, i.e. lon - eqOfTime modulo 360
+  core::SunTransit ChebyshevEphemeris::transitAt (double d, double lon) const {
+    const Sample sun = at (d);
+    core::SunTransit tr;
+    tr.tsouth = 12.0 - core::rev180 (lon - sun.eqOfTime) / 15.0;
+    tr.sradius = 0.2666 / sun.r;
+    tr.sinDec = sun.sinDec;
+    tr.cosDec = sun.cosDec;
+    return tr;
+  }
+
+  core::RiseSet ChebyshevEphemeris::sunriset (long days, double lon, double lat, double altit,
+                                              bool upperLimb) const {
+    const core::SunTransit tr = transitAt (days + 0.5 - lon / 360.0, lon);
+    if (upperLimb)
+      altit -= tr.sradius;
+
+    const core::DiurnalArc arc
+        = core::diurnalArc (core::sind (altit), core::sind (lat), core::cosd (lat), tr);
+    return { tr.tsouth - arc.t, tr.tsouth + arc.t, arc.rc };
+  }
+
+  int ChebyshevEphemeris::sunriset (int year, int month, int day, double lon, double lat,
+                                    double altit, int upperLimb, double& rise,
+                                    double& set) const {
+    const core::RiseSet rs
+        = sunriset (core::daysSince2000Jan0 (year, month, day), lon, lat, altit, upperLimb != 0);
+    rise = rs.rise;
+    set = rs.set;
+    return rs.rc;
+  }
+
+  void ChebyshevEphemeris::sunrisetBatch (int year, int month, int day, const double* lon,
+                                          const double* lat, std::size_t count, double* rise,
+                                          double* set, std::int8_t* status,
+                                          SolarEvent event) const {
+    const long days = core::daysSince2000Jan0 (year, month, day);
+    const SolarEventParams params = solarEventParams (event);
+
+    for (std::size_t i = 0; i < count; ++i) {
+      const core::RiseSet rs = sunriset (days, lon[i], lat[i], params.altit, params.upperLimb);
+      rise[i] = rs.rise;
+      set[i] = rs.set;
+      if (status)
+        status[i] = static_cast<std::int8_t> (rs.rc);
+    }
+  }
+
+} // namespace dotname
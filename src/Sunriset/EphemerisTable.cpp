@@ -0,0 +1,228 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <Logger/Logger.hpp>
+#include <Sunriset/EphemerisTable.hpp>
+#include <Utils/Utils.hpp>
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+namespace dotname {
+
+  namespace {
+
+    constexpr char kMagic[4] = { 'S', 'R', 'E', 'T' };
+    constexpr std::uint32_t kVersion = 1;
+    constexpr long kBlockDays = 366;
+
+    // Range of d reachable from 1801-01-01 .. 2099-12-31 with the -lon/360 shift
+    constexpr double kFirstD = core::daysSince2000Jan0 (1801, 1, 1) - 1.0;
+    constexpr double kLastD = core::daysSince2000Jan0 (2099, 12, 31) + 2.0;
+    constexpr std::size_t kBlockCount
+        = static_cast<std::size_t> ((kLastD - kFirstD) / kBlockDays) + 1;
+
+    struct FileHeader {
+      char magic[4];
+      std::uint32_t version;
+      std::uint32_t samplesPerDay;
+      std::uint32_t blockCount;
+      std::uint32_t samplesPerBlock;
+    };
+
+    EphemerisTable::Sample exactSample (double d) {
+      const core::SunEquatorial sun = core::sunRaDec (d);
+      return { sun.ra, core::sind (sun.dec), core::cosd (sun.dec), sun.r };
+    }
+
+  } // namespace
+
+  // One sample before the block start and two past its end, so every interpolation
+  // stencil inside the block is complete
+  struct EphemerisTable::Block {
+    std::vector<Sample> samples;
+  };
+
+  EphemerisTable::EphemerisTable (int samplesPerDay)
+      : samplesPerDay_ (samplesPerDay < 1 ? 1 : samplesPerDay),
+        step_ (1.0 / (samplesPerDay < 1 ? 1 : samplesPerDay)), blocks_ (kBlockCount),
+        owned_ (kBlockCount) {
+    for (auto& b : blocks_)
+      b.store (nullptr, std::memory_order_relaxed);
+  }
+
+  EphemerisTable::~EphemerisTable () = default;
+
+  std::unique_ptr<EphemerisTable::Block> EphemerisTable::buildBlock (std::size_t index) const {
+    auto block = std::make_unique<Block> ();
+    const std::size_t n = static_cast<std::size_t> (kBlockDays * samplesPerDay_) + 3;
+    const double start = kFirstD + static_cast<double> (index * kBlockDays);
+    block->samples.resize (n);
+
+    double prevRa = 0.0;
+    for (std::size_t j = 0; j < n; ++j) {
+      Sample s = exactSample (start + (static_cast<double> (j) - 1.0) * step_);
+      if (j > 0) {
+        while (s.ra - prevRa > 180.0)
+          s.ra -= 360.0;
+        while (s.ra - prevRa < -180.0)
+          s.ra += 360.0;
+      }
+      prevRa = s.ra;
+      block->samples[j] = s;
+    }
+    return block;
+  }
+
+  const EphemerisTable::Block& EphemerisTable::block (std::size_t index) const {
+    const Block* b = blocks_[index].load (std::memory_order_acquire);
+    if (b)
+      return *b;
+
+    std::lock_guard<std::mutex> lock (buildMutex_);
+    b = blocks_[index].load (std::memory_order_relaxed);
+    if (!b) {
+      owned_[index] = buildBlock (index);
+      b = owned_[index].get ();
+      blocks_[index].store (b, std::memory_order_release);
+    }
+    return *b;
+  }
+
+  EphemerisTable::Sample EphemerisTable::at (double d) const {
+    if (!(d >= kFirstD && d < kLastD))
+      return exactSample (d);
+
+    const double offset = d - kFirstD;
+    const std::size_t index = static_cast<std::size_t> (offset / kBlockDays);
+    const double u = (offset - static_cast<double> (index * kBlockDays)) * samplesPerDay_;
+    const double k = std::floor (u);
+    const double f = u - k;
+    const Sample* s = block (index).samples.data () + static_cast<std::size_t> (k);
+
+    // Cubic Lagrange weights for nodes -1, 0, 1, 2
+    const double fm1 = f - 1.0, fm2 = f - 2.0, fp1 = f + 1.0;
+    const double w0 = -f * fm1 * fm2 / 6.0;
+    const double w1 = fp1 * fm1 * fm2 / 2.0;
+    const double w2 = -fp1 * f * fm2 / 2.0;
+    const double w3 = fp1 * f * fm1 / 6.0;
+
+    Sample out;
+    out.ra = w0 * s[0].ra + w1 * s[1].ra + w2 * s[2].ra + w3 * s[3].ra;
+    out.sinDec = w0 * s[0].sinDec + w1 * s[1].sinDec + w2 * s[2].sinDec + w3 * s[3].sinDec;
+    out.cosDec = w0 * s[0].cosDec + w1 * s[1].cosDec + w2 * s[2].cosDec + w3 * s[3].cosDec;
+    out.r = w0 * s[0].r + w1 * s[1].r + w2 * s[2].r + w3 * s[3].r;
+    return out;
+  }
+
+  core::RiseSet EphemerisTable::sunriset (long days, double lon, double lat, double altit,
+                                          bool upperLimb) const {
+    const double d = days + 0.5 - lon / 360.0;
+    const double sidtime = core::revolution (core::gmst0 (d) + 180.0 + lon);
+    const Sample sun = at (d);
+    const double tsouth = 12.0 - core::rev180 (sidtime - sun.ra) / 15.0;
+
+    if (upperLimb)
+      altit -= 0.2666 / sun.r;
+
+    core::RiseSet out;
+    double t;
+    const double cost
+        = (core::sind (altit) - core::sind (lat) * sun.sinDec) / (core::cosd (lat) * sun.cosDec);
+    if (cost >= 1.0)
+      out.rc = -1, t = 0.0;
+    else if (cost <= -1.0)
+      out.rc = +1, t = 12.0;
+    else
+      out.rc = 0, t = core::acosd (cost) / 15.0;
+
+    out.rise = tsouth - t;
+    out.set = tsouth + t;
+    return out;
+  }
+
+  int EphemerisTable::sunriset (int year, int month, int day, double lon, double lat,
+                                double altit, int upperLimb, double& rise, double& set) const {
+    const core::RiseSet rs
+        = sunriset (core::daysSince2000Jan0 (year, month, day), lon, lat, altit, upperLimb != 0);
+    rise = rs.rise;
+    set = rs.set;
+    return rs.rc;
+  }
+
+  void EphemerisTable::sunrisetBatch (int year, int month, int day, const double* lon,
+                                      const double* lat, std::size_t count, double* rise,
+                                      double* set, std::int8_t* status, SolarEvent event) const {
+    const long days = core::daysSince2000Jan0 (year, month, day);
+    const SolarEventParams params = solarEventParams (event);
+
+    for (std::size_t i = 0; i < count; ++i) {
+      const core::RiseSet rs = sunriset (days, lon[i], lat[i], params.altit, params.upperLimb);
+      rise[i] = rs.rise;
+      set[i] = rs.set;
+      if (status)
+        status[i] = static_cast<std::int8_t> (rs.rc);
+    }
+  }
+
+  bool EphemerisTable::save (const std::filesystem::path& filePath) const {
+    std::ofstream file (filePath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+      LOG_E_STREAM << "Cannot write ephemeris table " << filePath << std::endl;
+      return false;
+    }
+
+    FileHeader header;
+    std::memcpy (header.magic, kMagic, sizeof (kMagic));
+    header.version = kVersion;
+    header.samplesPerDay = static_cast<std::uint32_t> (samplesPerDay_);
+    header.blockCount = static_cast<std::uint32_t> (kBlockCount);
+    header.samplesPerBlock = static_cast<std::uint32_t> (kBlockDays * samplesPerDay_ + 3);
+    file.write (reinterpret_cast<const char*> (&header), sizeof (header));
+
+    for (std::size_t i = 0; i < kBlockCount; ++i) {
+      const Block& b = block (i);
+      file.write (reinterpret_cast<const char*> (b.samples.data ()),
+                  static_cast<std::streamsize> (b.samples.size () * sizeof (Sample)));
+    }
+    return static_cast<bool> (file);
+  }
+
+  bool EphemerisTable::load (const std::filesystem::path& filePath) {
+    const Utils::FSManager::MappedFile file (filePath);
+    FileHeader header{};
+    if (file.size () >= sizeof (header))
+      std::memcpy (&header, file.data (), sizeof (header));
+    if (std::memcmp (header.magic, kMagic, sizeof (kMagic)) != 0 || header.version != kVersion
+        || header.blockCount != kBlockCount || header.samplesPerDay < 1
+        || header.samplesPerBlock != kBlockDays * header.samplesPerDay + 3) {
+      LOG_E_STREAM << "Invalid ephemeris table " << filePath << std::endl;
+      return false;
+    }
+    const std::size_t blockBytes = header.samplesPerBlock * sizeof (Sample);
+    if (file.size () < sizeof (header) + kBlockCount * blockBytes) {
+      LOG_E_STREAM << "Truncated ephemeris table " << filePath << std::endl;
+      return false;
+    }
+
+    // copied straight from the page cache, no stream buffer in between
+    std::vector<std::unique_ptr<Block>> loaded (kBlockCount);
+    const char* in = file.data () + sizeof (header);
+    for (auto& b : loaded) {
+      b = std::make_unique<Block> ();
+      b->samples.resize (header.samplesPerBlock);
+      std::memcpy (b->samples.data (), in, blockBytes);
+      in += blockBytes;
+    }
+
+    std::lock_guard<std::mutex> lock (buildMutex_);
+    samplesPerDay_ = static_cast<int> (header.samplesPerDay);
+    step_ = 1.0 / samplesPerDay_;
+    owned_ = std::move (loaded);
+    for (std::size_t i = 0; i < kBlockCount; ++i)
+      blocks_[i].store (owned_[i].get (), std::memory_order_release);
+    return true;
+  }
+
+} // namespace dotname
@@ -0,0 +1,56 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __GRIDPLAN_HPP
+#define __GRIDPLAN_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <Sunriset/SolarCore.hpp>
+#include <Sunriset/SolarGrid.hpp>
+
+namespace dotname {
+  namespace grid {
+
+    // sunrisetGrid split into its two passes so they can be run in pieces:
+    // prepareColumns() fills the per-column ephemeris, fillRows() then writes whole rows.
+    // Disjoint column / row ranges may run concurrently; every row depends on all
+    // columns, so fillRows() must only start once all columns are prepared.
+    class GridPlan {
+    public:
+      GridPlan (int year, int month, int day, const GridSpec& grid, const GridOptions& options,
+                double* rise, double* set, double* dayLength, std::int8_t* status);
+
+      void prepareColumns (std::size_t begin, std::size_t end);
+      void fillRows (std::size_t begin, std::size_t end) const;
+
+    private:
+      struct Column {
+        core::SunTransit transit;
+        double sinAltit; // sind of the limb-corrected altitude
+      };
+
+      Column columnAt (double lon) const;
+
+      GridSpec grid_;
+      GridOptions options_;
+      long days_;
+      SolarEventParams params_;
+      double* rise_;
+      double* set_;
+      double* dayLength_;
+      std::int8_t* status_;
+
+      std::vector<Column> columns_;
+      std::vector<double> tsouth_;
+      std::vector<double> x_;
+      std::vector<double> x2_;
+      Column nodes_[5];
+    };
+
+  } // namespace grid
+} // namespace dotname
+
+#endif // __GRIDPLAN_HPP
@@ -0,0 +1,131 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <Sunriset/LocationSet.hpp>
+#include <Sunriset/SolarCore.hpp>
+
+namespace dotname {
+
+  bool LocationSet::add (std::uint64_t id, double lat, double lon) {
+    const std::size_t slot = size ();
+    if (!index_.emplace (id, slot).second) {
+      return false;
+    }
+    ids_.push_back (id);
+    lon_.push_back (0.0);
+    lat_.push_back (0.0);
+    sinLat_.push_back (0.0);
+    cosLat_.push_back (0.0);
+    lonFraction_.push_back (0.0);
+    live_.push_back (1);
+    assign (slot, lat, lon);
+    return true;
+  }
+
+  bool LocationSet::update (std::uint64_t id, double lat, double lon) {
+    const std::size_t slot = find (id);
+    if (slot == npos) {
+      return false;
+    }
+    assign (slot, lat, lon);
+    return true;
+  }
+
+  bool LocationSet::remove (std::uint64_t id) {
+    const auto it = index_.find (id);
+    if (it == index_.end ()) {
+      return false;
+    }
+    live_[it->second] = 0;
+    index_.erase (it);
+    return true;
+  }
+
+  std::size_t LocationSet::compact () {
+    const std::size_t before = size ();
+    std::size_t kept = 0;
+    for (std::size_t slot = 0; slot < before; ++slot) {
+      if (!live_[slot]) {
+        continue;
+      }
+      if (kept != slot) {
+        ids_[kept] = ids_[slot];
+        lon_[kept] = lon_[slot];
+        lat_[kept] = lat_[slot];
+        sinLat_[kept] = sinLat_[slot];
+        cosLat_[kept] = cosLat_[slot];
+        lonFraction_[kept] = lonFraction_[slot];
+        live_[kept] = 1;
+        index_[ids_[kept]] = kept;
+      }
+      ++kept;
+    }
+    ids_.resize (kept);
+    lon_.resize (kept);
+    lat_.resize (kept);
+    sinLat_.resize (kept);
+    cosLat_.resize (kept);
+    lonFraction_.resize (kept);
+    live_.resize (kept);
+    return before - kept;
+  }
+
+  void LocationSet::reserve (std::size_t count) {
+    ids_.reserve (count);
+    lon_.reserve (count);
+    lat_.reserve (count);
+    sinLat_.reserve (count);
+    cosLat_.reserve (count);
+    lonFraction_.reserve (count);
+    live_.reserve (count);
+    index_.reserve (count);
+  }
+
+  void LocationSet::clear () {
+    ids_.clear ();
+    lon_.clear ();
+    lat_.clear ();
+    sinLat_.clear ();
+    cosLat_.clear ();
+    lonFraction_.clear ();
+    live_.clear ();
+    index_.clear ();
+  }
+
+  std::size_t LocationSet::find (std::uint64_t id) const {
+    const auto it = index_.find (id);
+    return it == index_.end () ? npos : it->second;
+  }
+
+  // The same expressions as __sunriset__, so the precomputed terms are bit-identical
+  void LocationSet::assign (std::size_t slot, double lat, double lon) {
+    lon_[slot] = lon;
+    lat_[slot] = lat;
+    sinLat_[slot] = core::sind (lat);
+    cosLat_[slot] = core::cosd (lat);
+    lonFraction_[slot] = lon / 360.0;
+  }
+
+  void sunrisetBatch (int year, int month, int day, const LocationSet& sites, double* rise,
+                      double* set, std::int8_t* status, SolarEvent event) {
+    const long days = core::daysSince2000Jan0 (year, month, day);
+    const SolarEventParams params = solarEventParams (event);
+    const double sinAltit = core::sind (params.altit);
+    const double* lon = sites.lon ();
+    const double* lonFraction = sites.lonFraction ();
+    const double* sinLat = sites.sinLat ();
+    const double* cosLat = sites.cosLat ();
+
+    for (std::size_t i = 0; i < sites.size (); ++i) {
+      const core::SunTransit tr = core::sunTransitAt (days + 0.5 - lonFraction[i], lon[i]);
+      const double sinHorizon
+          = params.upperLimb ? core::sind (params.altit - tr.sradius) : sinAltit;
+      const core::DiurnalArc arc = core::diurnalArc (sinHorizon, sinLat[i], cosLat[i], tr);
+      rise[i] = tr.tsouth - arc.t;
+      set[i] = tr.tsouth + arc.t;
+      if (status)
+        status[i] = static_cast<std::int8_t> (arc.rc);
+    }
+  }
+
+} // namespace dotname
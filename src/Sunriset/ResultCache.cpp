@@ -0,0 +1,326 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <Logger/Logger.hpp>
+#include <Sunriset/ResultCache.hpp>
+#include <Sunriset/SolarCore.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <mutex>
+#include <thread>
+
+namespace dotname {
+
+  namespace {
+
+    constexpr double kDefaultGrid = 0.001;
+    constexpr double kMinGrid = 1e-6; // keeps a snapped longitude within 32 bits
+
+    std::size_t ceilPow2 (std::size_t n) {
+      std::size_t p = 1;
+      while (p < n)
+        p <<= 1;
+      return p;
+    }
+
+    std::uint64_t mix (std::uint64_t x) {
+      x ^= x >> 30;
+      x *= 0xbf58476d1ce4e5b9ull;
+      x ^= x >> 27;
+      x *= 0x94d049bb133111ebull;
+      return x ^ (x >> 31);
+    }
+
+    // Small per-thread number spreading the hit counters over their stripes
+    std::size_t threadStripe () {
+      static std::atomic<std::size_t> next{ 0 };
+      thread_local const std::size_t stripe = next.fetch_add (1, std::memory_order_relaxed);
+      return stripe;
+    }
+
+  } // namespace
+
+  // Snapped lat/lon in one word, the day number and the event in the other
+  struct ResultCache::Key {
+    std::uint64_t location;
+    std::uint64_t dayEvent;
+
+    bool operator== (const Key& other) const {
+      return location == other.location && dayEvent == other.dayEvent;
+    }
+    std::uint64_t hash () const {
+      return mix (location ^ mix (dayEvent));
+    }
+  };
+
+  // Entries and index slots are atomics so get () can read them without the shard mutex;
+  // writers hold the mutex and make `version` odd while they change them (a seqlock).
+  // Readers take a snapshot only when the version is even and unchanged around it.
+  struct alignas (64) ResultCache::Shard {
+    struct Entry {
+      std::atomic<std::uint64_t> location{ 0 };
+      std::atomic<std::uint64_t> dayEvent{ 0 };
+      std::atomic<double> start{ 0.0 };
+      std::atomic<double> end{ 0.0 };
+      std::atomic<std::int8_t> status{ 0 };
+      std::atomic<bool> referenced{ false };
+
+      Key key () const {
+        return { location.load (std::memory_order_relaxed),
+                 dayEvent.load (std::memory_order_relaxed) };
+      }
+    };
+
+    static constexpr std::uint32_t kEmpty = 0;
+
+    std::atomic<std::uint64_t> version{ 0 };
+    std::mutex mutex;
+    std::unique_ptr<Entry[]> entries;                 // `capacity` of them, the first `size` in use
+    std::unique_ptr<std::atomic<std::uint32_t>[]> index; // entry + 1, kEmpty when free
+    std::size_t capacity = 0;
+    std::size_t indexMask = 0;
+    std::size_t size = 0;
+    std::size_t hand = 0;
+    std::uint64_t misses = 0;
+    std::uint64_t evictions = 0;
+
+    void init (std::size_t entryCount) {
+      capacity = entryCount;
+      entries.reset (new Entry[capacity]);
+      indexMask = ceilPow2 (2 * capacity) - 1;
+      index.reset (new std::atomic<std::uint32_t>[indexMask + 1]);
+      for (std::size_t i = 0; i <= indexMask; ++i)
+        index[i].store (kEmpty, std::memory_order_relaxed);
+    }
+
+    std::uint32_t slotAt (std::size_t slot) const {
+      return index[slot].load (std::memory_order_relaxed);
+    }
+
+    std::size_t home (std::uint64_t hash) const {
+      return static_cast<std::size_t> (hash) & indexMask;
+    }
+
+    // Index slot holding the key, or the free slot where it would go. A reader racing a
+    // writer may see a torn index, so the walk is bounded by the table size.
+    std::size_t probe (const Key& key, std::uint64_t hash) const {
+      std::size_t slot = home (hash);
+      for (std::size_t step = 0; step <= indexMask; ++step) {
+        const std::uint32_t entry = slotAt (slot);
+        if (entry == kEmpty || entries[entry - 1].key () == key)
+          break;
+        slot = (slot + 1) & indexMask;
+      }
+      return slot;
+    }
+
+    void beginWrite () {
+      version.store (version.load (std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+      std::atomic_thread_fence (std::memory_order_release);
+    }
+
+    void endWrite () {
+      version.store (version.load (std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    // Without the mutex: true and the result if a consistent snapshot was taken, with
+    // `found` telling hit from miss; false if writers kept the shard busy
+    bool tryFind (const Key& key, std::uint64_t hash, bool& found,
+                  SolarEventTimes& times) const {
+      constexpr int kAttempts = 4;
+      for (int attempt = 0; attempt < kAttempts; ++attempt) {
+        const std::uint64_t before = version.load (std::memory_order_acquire);
+        if (before & 1)
+          continue;
+        const std::uint32_t entry = slotAt (probe (key, hash));
+        found = entry != kEmpty;
+        if (found) {
+          const Entry& e = entries[entry - 1];
+          times = { e.start.load (std::memory_order_relaxed),
+                    e.end.load (std::memory_order_relaxed),
+                    e.status.load (std::memory_order_relaxed) };
+        }
+        std::atomic_thread_fence (std::memory_order_acquire);
+        if (version.load (std::memory_order_relaxed) == before) {
+          // The CLOCK bit is a hint; setting it only when clear keeps hot entries' lines
+          // shared between the cores reading them
+          if (found && !entries[entry - 1].referenced.load (std::memory_order_relaxed))
+            entries[entry - 1].referenced.store (true, std::memory_order_relaxed);
+          return true;
+        }
+      }
+      return false;
+    }
+
+    // Backward-shift deletion keeps every probe chain unbroken without tombstones
+    void unlink (std::size_t slot) {
+      std::size_t hole = slot;
+      for (std::size_t next = (hole + 1) & indexMask; slotAt (next) != kEmpty;
+           next = (next + 1) & indexMask) {
+        const std::size_t want = home (entries[slotAt (next) - 1].key ().hash ());
+        // The entry may fill the hole unless its home lies cyclically in (hole, next]
+        const bool stays = hole <= next ? (want > hole && want <= next)
+                                        : (want > hole || want <= next);
+        if (!stays) {
+          index[hole].store (slotAt (next), std::memory_order_relaxed);
+          hole = next;
+        }
+      }
+      index[hole].store (kEmpty, std::memory_order_relaxed);
+    }
+
+    // Caller holds the mutex
+    void insert (const Key& key, std::uint64_t hash, const SolarEventTimes& times) {
+      std::size_t slot = probe (key, hash);
+      if (slotAt (slot) != kEmpty) {
+        return; // another thread stored it while this one was computing
+      }
+      beginWrite ();
+      std::size_t entry;
+      if (size < capacity) {
+        entry = size++;
+      } else {
+        while (entries[hand].referenced.load (std::memory_order_relaxed)) {
+          entries[hand].referenced.store (false, std::memory_order_relaxed);
+          hand = hand + 1 == capacity ? 0 : hand + 1;
+        }
+        entry = hand;
+        hand = hand + 1 == capacity ? 0 : hand + 1;
+        const Key evicted = entries[entry].key ();
+        unlink (probe (evicted, evicted.hash ()));
+        ++evictions;
+        slot = probe (key, hash); // the shift may have moved the free slot
+      }
+      Entry& e = entries[entry];
+      e.location.store (key.location, std::memory_order_relaxed);
+      e.dayEvent.store (key.dayEvent, std::memory_order_relaxed);
+      e.start.store (times.start, std::memory_order_relaxed);
+      e.end.store (times.end, std::memory_order_relaxed);
+      e.status.store (times.status, std::memory_order_relaxed);
+      e.referenced.store (false, std::memory_order_relaxed);
+      index[slot].store (static_cast<std::uint32_t> (entry + 1), std::memory_order_relaxed);
+      endWrite ();
+    }
+  };
+
+  // Hits are counted per thread stripe rather than per shard, so a hot key does not make
+  // every reader write the same line
+  struct alignas (64) ResultCache::HitCounter {
+    std::atomic<std::uint64_t> hits{ 0 };
+  };
+
+  ResultCache::ResultCache () : ResultCache (Config ()) {}
+
+  ResultCache::ResultCache (const Config& config) : grid_ (config.gridDegrees) {
+    if (!(grid_ >= kMinGrid && grid_ <= 90.0)) {
+      LOG_E_STREAM << "ResultCache: grid of " << grid_ << " degrees is outside [" << kMinGrid
+                   << ", 90], using " << kDefaultGrid << std::endl;
+      grid_ = kDefaultGrid;
+    }
+    inverseGrid_ = 1.0 / grid_;
+
+    const std::size_t threads = std::max (1u, std::thread::hardware_concurrency ());
+    std::size_t shards = config.shards;
+    if (shards == 0) {
+      shards = 4 * threads;
+    }
+    const std::size_t capacity = std::max<std::size_t> (config.capacity, 1);
+    shards = std::min (ceilPow2 (shards), ceilPow2 (capacity));
+    shardMask_ = shards - 1;
+    shards_.reset (new Shard[shards]);
+    const std::size_t perShard = (capacity + shards - 1) / shards;
+    for (std::size_t i = 0; i < shards; ++i)
+      shards_[i].init (perShard);
+
+    hitCounterMask_ = ceilPow2 (threads) - 1;
+    hitCounters_.reset (new HitCounter[hitCounterMask_ + 1]);
+  }
+
+  ResultCache::~ResultCache () = default;
+
+  SolarEventTimes ResultCache::get (int year, int month, int day, double lon, double lat,
+                                    SolarEvent event) {
+    const auto snappedLat = static_cast<std::int32_t> (
+        std::lround (std::clamp (lat, -90.0, 90.0) * inverseGrid_));
+    const auto snappedLon = static_cast<std::int32_t> (
+        std::lround (std::clamp (lon, -360.0, 360.0) * inverseGrid_));
+    const long days = core::daysSince2000Jan0 (year, month, day);
+    const Key key{ static_cast<std::uint64_t> (static_cast<std::uint32_t> (snappedLat)) << 32
+                       | static_cast<std::uint32_t> (snappedLon),
+                   static_cast<std::uint64_t> (days) << 8 | static_cast<std::uint8_t> (event) };
+    const std::uint64_t hash = key.hash ();
+    Shard& shard = shards_[(hash >> 40) & shardMask_];
+    HitCounter& counter = hitCounters_[threadStripe () & hitCounterMask_];
+
+    bool found = false;
+    SolarEventTimes times;
+    if (shard.tryFind (key, hash, found, times) && found) {
+      counter.hits.fetch_add (1, std::memory_order_relaxed);
+      return times;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock (shard.mutex);
+      const std::uint32_t entry = shard.slotAt (shard.probe (key, hash));
+      if (entry != Shard::kEmpty) {
+        Shard::Entry& e = shard.entries[entry - 1];
+        e.referenced.store (true, std::memory_order_relaxed);
+        counter.hits.fetch_add (1, std::memory_order_relaxed);
+        return { e.start.load (std::memory_order_relaxed), e.end.load (std::memory_order_relaxed),
+                 e.status.load (std::memory_order_relaxed) };
+      }
+      ++shard.misses;
+    }
+
+    // Computed outside the lock; a concurrent miss on the same key computes the same value
+    const SolarEventParams params = solarEventParams (event);
+    const core::RiseSet rs = core::sunriset (days, snappedLon * grid_, snappedLat * grid_,
+                                             params.altit, params.upperLimb);
+    times = { rs.rise, rs.set, static_cast<std::int8_t> (rs.rc) };
+
+    std::lock_guard<std::mutex> lock (shard.mutex);
+    shard.insert (key, hash, times);
+    return times;
+  }
+
+  ResultCache::Stats ResultCache::stats () const {
+    Stats stats{};
+    for (std::size_t i = 0; i <= hitCounterMask_; ++i)
+      stats.hits += hitCounters_[i].hits.load (std::memory_order_relaxed);
+    for (std::size_t i = 0; i <= shardMask_; ++i) {
+      Shard& shard = shards_[i];
+      std::lock_guard<std::mutex> lock (shard.mutex);
+      stats.misses += shard.misses;
+      stats.evictions += shard.evictions;
+      stats.size += shard.size;
+      stats.capacity += shard.capacity;
+    }
+    return stats;
+  }
+
+  void ResultCache::resetStats () {
+    for (std::size_t i = 0; i <= hitCounterMask_; ++i)
+      hitCounters_[i].hits.store (0, std::memory_order_relaxed);
+    for (std::size_t i = 0; i <= shardMask_; ++i) {
+      Shard& shard = shards_[i];
+      std::lock_guard<std::mutex> lock (shard.mutex);
+      shard.misses = shard.evictions = 0;
+    }
+  }
+
+  void ResultCache::clear () {
+    for (std::size_t i = 0; i <= shardMask_; ++i) {
+      Shard& shard = shards_[i];
+      std::lock_guard<std::mutex> lock (shard.mutex);
+      shard.beginWrite ();
+      for (std::size_t slot = 0; slot <= shard.indexMask; ++slot)
+        shard.index[slot].store (Shard::kEmpty, std::memory_order_relaxed);
+      shard.endWrite ();
+      shard.size = 0;
+      shard.hand = 0;
+    }
+  }
+
+} // namespace dotname
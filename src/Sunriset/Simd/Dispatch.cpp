@@ -0,0 +1,291 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <Sunriset/Batch.hpp>
+#include <Sunriset/LocationSet.hpp>
+#include <Sunriset/SolarCore.hpp>
+
+#include "Sunriset/Simd/SimdVec.hpp"
+#include "Sunriset/Simd/ElevationKernel.hpp"
+#include "Sunriset/Simd/SunrisetKernel.hpp"
+#include "Sunriset/Simd/SunrisetKernelFloat.hpp"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  #include <intrin.h>
+#endif
+
+namespace dotname {
+
+  namespace {
+
+    bool cpuHasAvx2 () {
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+      return __builtin_cpu_supports ("avx2") && __builtin_cpu_supports ("fma");
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+      int info[4];
+      __cpuid (info, 1);
+      const bool osxsave = (info[2] & (1 << 27)) != 0;
+      const bool fma = (info[2] & (1 << 12)) != 0;
+      if (!osxsave || !fma || (_xgetbv (0) & 0x6) != 0x6)
+        return false;
+      __cpuidex (info, 7, 0);
+      return (info[1] & (1 << 5)) != 0;
+#else
+      return false;
+#endif
+    }
+
+    bool cpuHasAvx512 () {
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+      return __builtin_cpu_supports ("avx512f") && __builtin_cpu_supports ("avx512dq");
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+      if (!cpuHasAvx2 () || (_xgetbv (0) & 0xe6) != 0xe6)
+        return false;
+      int info[4];
+      __cpuidex (info, 7, 0);
+      return (info[1] & (1 << 16)) != 0 && (info[1] & (1 << 17)) != 0;
+#else
+      return false;
+#endif
+    }
+
+    simd::SunrisetKernelFn kernelFor (SimdLevel level) {
+      switch (level) {
+      case SimdLevel::Avx512:
+        return simd::sunrisetKernelAvx512 ();
+      case SimdLevel::Avx2:
+        return simd::sunrisetKernelAvx2 ();
+      case SimdLevel::Sse2:
+        return simd::sunrisetKernelSse2 ();
+      default:
+        return nullptr;
+      }
+    }
+
+    simd::SunrisetKernelFloatFn kernelForFloat (SimdLevel level) {
+      switch (level) {
+      case SimdLevel::Avx512:
+        return simd::sunrisetKernelFloatAvx512 ();
+      case SimdLevel::Avx2:
+        return simd::sunrisetKernelFloatAvx2 ();
+      case SimdLevel::Sse2:
+        return simd::sunrisetKernelFloatSse2 ();
+      default:
+        return nullptr;
+      }
+    }
+
+    simd::ElevationKernelFn elevationKernelFor (SimdLevel level) {
+      switch (level) {
+      case SimdLevel::Avx512:
+        return simd::elevationKernelAvx512 ();
+      case SimdLevel::Avx2:
+        return simd::elevationKernelAvx2 ();
+      case SimdLevel::Sse2:
+        return simd::elevationKernelSse2 ();
+      default:
+        return nullptr;
+      }
+    }
+
+    SimdLevel detectSimdLevel () {
+      if (cpuHasAvx512 () && kernelFor (SimdLevel::Avx512))
+        return SimdLevel::Avx512;
+      if (cpuHasAvx2 () && kernelFor (SimdLevel::Avx2))
+        return SimdLevel::Avx2;
+      if (kernelFor (SimdLevel::Sse2))
+        return SimdLevel::Sse2;
+      return SimdLevel::Scalar;
+    }
+
+  } // namespace
+
+  SimdLevel simdLevel () {
+    static const SimdLevel level = detectSimdLevel ();
+    return level;
+  }
+
+  const char* simdLevelName (SimdLevel level) {
+    switch (level) {
+    case SimdLevel::Auto:
+      return simdLevelName (simdLevel ());
+    case SimdLevel::Sse2:
+      return "SSE2";
+    case SimdLevel::Avx2:
+      return "AVX2";
+    case SimdLevel::Avx512:
+      return "AVX-512";
+    case SimdLevel::Scalar:
+    default:
+      return "scalar";
+    }
+  }
+
+  namespace simd {
+
+    bool runSunrisetKernel (SimdLevel level, SunrisetKernelArgs& args, SolarEvent event) {
+      const SimdLevel best = simdLevel ();
+      if (level == SimdLevel::Auto || level > best)
+        level = best;
+
+      const SunrisetKernelFn kernel = kernelFor (level);
+      if (!kernel)
+        return false;
+
+      const SolarEventParams params = solarEventParams (event);
+      args.altit = params.altit;
+      args.upperLimb = params.upperLimb;
+      kernel (args);
+      return true;
+    }
+
+    void runSunrisetKernelFloat (SimdLevel level, SunrisetKernelFloatArgs& args,
+                                 SolarEvent event) {
+      const SimdLevel best = simdLevel ();
+      if (level == SimdLevel::Auto || level > best)
+        level = best;
+
+      SunrisetKernelFloatFn kernel = kernelForFloat (level);
+      if (!kernel)
+        kernel = &sunrisetKernelFloat<VecScalarF>;
+
+      const SolarEventParams params = solarEventParams (event);
+      args.altit = params.altit;
+      args.upperLimb = params.upperLimb;
+      kernel (args);
+    }
+
+    bool runElevationKernel (SimdLevel level, const ElevationKernelArgs& args) {
+      const SimdLevel best = simdLevel ();
+      if (level == SimdLevel::Auto || level > best)
+        level = best;
+
+      const ElevationKernelFn kernel = elevationKernelFor (level);
+      if (!kernel)
+        return false;
+      kernel (args);
+      return true;
+    }
+
+  } // namespace simd
+
+  namespace {
+
+    // The kernels step the day number linearly, so a day range is run in two pieces
+    // around the skipped 1900-02-29: run (days, firstIndex, count)
+    template <class Run> void forEachLinearRun (long days, std::size_t dayCount, Run run) {
+      const long skip = core::kDays1900Feb28 - days;
+      if (skip >= 0 && static_cast<std::size_t> (skip) + 1 < dayCount) {
+        const std::size_t head = static_cast<std::size_t> (skip) + 1;
+        run (days, 0, head);
+        run (core::nextDay (core::kDays1900Feb28), head, dayCount - head);
+        return;
+      }
+      run (days, 0, dayCount);
+    }
+
+  } // namespace
+
+  void sunrisetBatchVectorized (int year, int month, int day, const double* lon,
+                                const double* lat, std::size_t count, double* rise, double* set,
+                                std::int8_t* status, SolarEvent event, SimdLevel level) {
+    simd::SunrisetKernelArgs args;
+    args.days = core::daysSince2000Jan0 (year, month, day);
+    args.dayStep = 0.0;
+    args.lon = lon;
+    args.lat = lat;
+    args.broadcastLocation = false;
+    args.rise = rise;
+    args.set = set;
+    args.status = status;
+    args.count = count;
+    if (!simd::runSunrisetKernel (level, args, event))
+      sunrisetBatch (year, month, day, lon, lat, count, rise, set, status, event);
+  }
+
+  void sunrisetBatchVectorized (int year, int month, int day, const LocationSet& sites,
+                                double* rise, double* set, std::int8_t* status, SolarEvent event,
+                                SimdLevel level) {
+    simd::SunrisetKernelArgs args;
+    args.days = core::daysSince2000Jan0 (year, month, day);
+    args.dayStep = 0.0;
+    args.lon = sites.lon ();
+    args.lat = sites.lat ();
+    args.broadcastLocation = false;
+    args.sinLat = sites.sinLat ();
+    args.cosLat = sites.cosLat ();
+    args.lonFraction = sites.lonFraction ();
+    args.rise = rise;
+    args.set = set;
+    args.status = status;
+    args.count = sites.size ();
+    if (!simd::runSunrisetKernel (level, args, event))
+      sunrisetBatch (year, month, day, sites, rise, set, status, event);
+  }
+
+  void sunrisetRangeVectorized (int year, int month, int day, std::size_t dayCount, double lon,
+                                double lat, double* rise, double* set, std::int8_t* status,
+                                SolarEvent event, SimdLevel level) {
+    bool vectorized = true;
+    forEachLinearRun (core::daysSince2000Jan0 (year, month, day), dayCount,
+                      [&] (long days, std::size_t first, std::size_t count) {
+                        simd::SunrisetKernelArgs args;
+                        args.days = days;
+                        args.dayStep = 1.0;
+                        args.lon = &lon;
+                        args.lat = &lat;
+                        args.broadcastLocation = true;
+                        args.rise = rise + first;
+                        args.set = set + first;
+                        args.status = status ? status + first : nullptr;
+                        args.count = count;
+                        vectorized = vectorized && simd::runSunrisetKernel (level, args, event);
+                      });
+    if (!vectorized)
+      sunrisetRange (year, month, day, dayCount, lon, lat, rise, set, status, event);
+  }
+
+  void sunrisetBatchFloat (int year, int month, int day, const float* lon, const float* lat,
+                           std::size_t count, float* rise, float* set, std::int8_t* status,
+                           SolarEvent event, SimdLevel level) {
+    simd::SunrisetKernelFloatArgs args;
+    args.days = core::daysSince2000Jan0 (year, month, day);
+    args.dayStep = 0.0f;
+    args.lon = lon;
+    args.lat = lat;
+    args.broadcastLocation = false;
+    args.rise = rise;
+    args.set = set;
+    args.status = status;
+    args.count = count;
+    simd::runSunrisetKernelFloat (level, args, event);
+  }
+
+  void sunrisetRangeFloat (int year, int month, int day, std::size_t dayCount, float lon,
+                           float lat, float* rise, float* set, std::int8_t* status,
+                           SolarEvent event, SimdLevel level) {
+    forEachLinearRun (core::daysSince2000Jan0 (year, month, day), dayCount,
+                      [&] (long days, std::size_t first, std::size_t count) {
+                        simd::SunrisetKernelFloatArgs args;
+                        args.days = days;
+                        args.dayStep = 1.0f;
+                        args.lon = &lon;
+                        args.lat = &lat;
+                        args.broadcastLocation = true;
+                        args.rise = rise + first;
+                        args.set = set + first;
+                        args.status = status ? status + first : nullptr;
+                        args.count = count;
+                        simd::runSunrisetKernelFloat (level, args, event);
+                      });
+  }
+
+  int sunrisetFloat (int year, int month, int day, float lon, float lat, float& rise, float& set,
+                     SolarEvent event) {
+    std::int8_t status;
+    sunrisetBatchFloat (year, month, day, &lon, &lat, 1, &rise, &set, &status, event,
+                        SimdLevel::Scalar);
+    return status;
+  }
+
+} // namespace dotname
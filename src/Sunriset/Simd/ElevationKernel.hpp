@@ -0,0 +1,71 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __ELEVATIONKERNEL_HPP
+#define __ELEVATIONKERNEL_HPP
+
+#include <cstddef>
+
+#include <Sunriset/Batch.hpp>
+
+#include "Sunriset/Simd/SimdMath.hpp"
+
+namespace dotname {
+  namespace simd {
+
+    // sin (elevation) of the Sun for many observers at one instant:
+    // sinLat * sinDec + cosLat * cosDec * cosd (lon - subsolarLon)
+    struct ElevationKernelArgs {
+      const double* lon;
+      const double* sinLat;
+      const double* cosLat;
+      double subsolarLon;
+      double sinDec;
+      double cosDec;
+      double* sinElevation;
+      std::size_t count;
+    };
+
+    using ElevationKernelFn = void (*) (const ElevationKernelArgs&);
+
+    ElevationKernelFn elevationKernelSse2 ();
+    ElevationKernelFn elevationKernelAvx2 ();
+    ElevationKernelFn elevationKernelAvx512 ();
+
+    // false when only the scalar path is left
+    bool runElevationKernel (SimdLevel level, const ElevationKernelArgs& args);
+
+    template <class V> inline void elevationKernel (const ElevationKernelArgs& a) {
+      constexpr std::size_t W = V::width;
+      const V subsolarLon = V::set1 (a.subsolarLon);
+      const V sinDec = V::set1 (a.sinDec);
+      const V cosDec = V::set1 (a.cosDec);
+      const auto lanes = [&] (V lon, V sinLat, V cosLat) {
+        V sinH, cosH;
+        vsincosd (lon - subsolarLon, sinH, cosH);
+        return vfmadd (sinLat, sinDec, cosLat * cosDec * cosH);
+      };
+
+      std::size_t i = 0;
+      for (; i + W <= a.count; i += W)
+        lanes (V::load (a.lon + i), V::load (a.sinLat + i), V::load (a.cosLat + i))
+            .store (a.sinElevation + i);
+
+      if (i < a.count) {
+        const std::size_t n = a.count - i;
+        double lon[W] = {}, sinLat[W] = {}, cosLat[W] = {}, out[W];
+        for (std::size_t k = 0; k < n; ++k) {
+          lon[k] = a.lon[i + k];
+          sinLat[k] = a.sinLat[i + k];
+          cosLat[k] = a.cosLat[i + k];
+        }
+        lanes (V::load (lon), V::load (sinLat), V::load (cosLat)).store (out);
+        for (std::size_t k = 0; k < n; ++k)
+          a.sinElevation[i + k] = out[k];
+      }
+    }
+
+  } // namespace simd
+} // namespace dotname
+
+#endif // __ELEVATIONKERNEL_HPP
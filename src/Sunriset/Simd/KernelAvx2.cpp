@@ -0,0 +1,35 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include "Sunriset/Simd/SimdVec.hpp"
+#include "Sunriset/Simd/ElevationKernel.hpp"
+#include "Sunriset/Simd/SunrisetKernel.hpp"
+#include "Sunriset/Simd/SunrisetKernelFloat.hpp"
+
+namespace dotname {
+  namespace simd {
+
+#if defined(SUNRISET_SIMD_AVX2)
+    SunrisetKernelFn sunrisetKernelAvx2 () {
+      return &sunrisetKernel<VecAvx2>;
+    }
+    SunrisetKernelFloatFn sunrisetKernelFloatAvx2 () {
+      return &sunrisetKernelFloat<VecAvx2F>;
+    }
+    ElevationKernelFn elevationKernelAvx2 () {
+      return &elevationKernel<VecAvx2>;
+    }
+#else
+    SunrisetKernelFn sunrisetKernelAvx2 () {
+      return nullptr;
+    }
+    SunrisetKernelFloatFn sunrisetKernelFloatAvx2 () {
+      return nullptr;
+    }
+    ElevationKernelFn elevationKernelAvx2 () {
+      return nullptr;
+    }
+#endif
+
+  } // namespace simd
+} // namespace dotname
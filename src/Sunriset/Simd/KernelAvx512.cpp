@@ -0,0 +1,35 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include "Sunriset/Simd/SimdVec.hpp"
+#include "Sunriset/Simd/ElevationKernel.hpp"
+#include "Sunriset/Simd/SunrisetKernel.hpp"
+#include "Sunriset/Simd/SunrisetKernelFloat.hpp"
+
+namespace dotname {
+  namespace simd {
+
+#if defined(SUNRISET_SIMD_AVX512)
+    SunrisetKernelFn sunrisetKernelAvx512 () {
+      return &sunrisetKernel<VecAvx512>;
+    }
+    SunrisetKernelFloatFn sunrisetKernelFloatAvx512 () {
+      return &sunrisetKernelFloat<VecAvx512F>;
+    }
+    ElevationKernelFn elevationKernelAvx512 () {
+      return &elevationKernel<VecAvx512>;
+    }
+#else
+    SunrisetKernelFn sunrisetKernelAvx512 () {
+      return nullptr;
+    }
+    SunrisetKernelFloatFn sunrisetKernelFloatAvx512 () {
+      return nullptr;
+    }
+    ElevationKernelFn elevationKernelAvx512 () {
+      return nullptr;
+    }
+#endif
+
+  } // namespace simd
+} // namespace dotname
@@ -0,0 +1,35 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include "Sunriset/Simd/SimdVec.hpp"
+#include "Sunriset/Simd/ElevationKernel.hpp"
+#include "Sunriset/Simd/SunrisetKernel.hpp"
+#include "Sunriset/Simd/SunrisetKernelFloat.hpp"
+
+namespace dotname {
+  namespace simd {
+
+#if defined(SUNRISET_SIMD_SSE2)
+    SunrisetKernelFn sunrisetKernelSse2 () {
+      return &sunrisetKernel<VecSse2>;
+    }
+    SunrisetKernelFloatFn sunrisetKernelFloatSse2 () {
+      return &sunrisetKernelFloat<VecSse2F>;
+    }
+    ElevationKernelFn elevationKernelSse2 () {
+      return &elevationKernel<VecSse2>;
+    }
+#else
+    SunrisetKernelFn sunrisetKernelSse2 () {
+      return nullptr;
+    }
+    SunrisetKernelFloatFn sunrisetKernelFloatSse2 () {
+      return nullptr;
+    }
+    ElevationKernelFn elevationKernelSse2 () {
+      return nullptr;
+    }
+#endif
+
+  } // namespace simd
+} // namespace dotname
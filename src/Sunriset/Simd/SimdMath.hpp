@@ -0,0 +1,212 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __SIMDMATH_HPP
+#define __SIMDMATH_HPP
+
+// Branch-free trigonometry for the vector wrappers in SimdVec.hpp.
+// The polynomials are the Cephes ones (sin.c, atan.c, and sinf.c, atanf.c for the
+// float wrappers) with a three-part Cody-Waite reduction by pi/4; quadrant fixups are
+// done with lane selects instead of branches. Over the argument ranges used by the
+// solar kernel the results stay within a few ulp of libm.
+
+#include <type_traits>
+
+namespace dotname {
+  namespace simd {
+
+    constexpr double kPi = 3.1415926535897932384;
+    constexpr double kRadeg = 180.0 / kPi;
+    constexpr double kDegrad = kPi / 180.0;
+
+    template <class V> inline V polevl (V x, const double* c, int n) {
+      V r = V::set1 (c[0]);
+      for (int i = 1; i <= n; ++i) {
+        r = vfmadd (r, x, V::set1 (c[i]));
+      }
+      return r;
+    }
+
+    template <class V> inline V p1evl (V x, const double* c, int n) {
+      V r = x + V::set1 (c[0]);
+      for (int i = 1; i < n; ++i) {
+        r = vfmadd (r, x, V::set1 (c[i]));
+      }
+      return r;
+    }
+
+    // Cephes sin/cos polynomials and pi/4 split per precision (sin.c, sinf.c)
+    template <class S> struct SinCosCoefficients {
+      static constexpr int degree = 5;
+      static constexpr double sincof[] = { 1.58962301576546568060E-10, -2.50507477628578072866E-8,
+                                           2.75573136213857245213E-6,  -1.98412698295895385996E-4,
+                                           8.33333333332211858878E-3,  -1.66666666666666307295E-1 };
+      static constexpr double coscof[] = { -1.13585365213876817300E-11, 2.08757008419747316778E-9,
+                                           -2.75573141792967388112E-7,  2.48015872888517045348E-5,
+                                           -1.38888888888730564116E-3,  4.16666666666665929218E-2 };
+      static constexpr double dp1 = 7.85398125648498535156E-1;
+      static constexpr double dp2 = 3.77489470793079817668E-8;
+      static constexpr double dp3 = 2.69515142907905952645E-15;
+    };
+
+    template <> struct SinCosCoefficients<float> {
+      static constexpr int degree = 2;
+      static constexpr double sincof[]
+          = { -1.9515295891E-4, 8.3321608736E-3, -1.6666654611E-1 };
+      static constexpr double coscof[]
+          = { 2.443315711809948E-5, -1.388731625493765E-3, 4.166664568298827E-2 };
+      static constexpr double dp1 = 0.78515625;
+      static constexpr double dp2 = 2.4187564849853515625E-4;
+      static constexpr double dp3 = 3.77489497744594108E-8;
+    };
+
+    template <class V> inline void vsincos (V x, V& s, V& c) {
+      using K = SinCosCoefficients<typename V::Scalar>;
+      const V zero = V::set1 (0.0);
+      const auto negative = cmpLt (x, zero);
+      const V ax = vabs (x);
+
+      // octant, rounded up to even so the reduced argument lies in [-pi/4, pi/4]
+      V y = vfloor (ax * V::set1 (4.0 / kPi));
+      y = y + (y - V::set1 (2.0) * vfloor (y * V::set1 (0.5)));
+      const V j = y - V::set1 (8.0) * vfloor (y * V::set1 (0.125));
+
+      V z = ax - y * V::set1 (K::dp1);
+      z = z - y * V::set1 (K::dp2);
+      z = z - y * V::set1 (K::dp3);
+      const V zz = z * z;
+
+      const V ps = vfmadd (z * zz, polevl (zz, K::sincof, K::degree), z);
+      const V pc = vfmadd (zz * zz, polevl (zz, K::coscof, K::degree),
+                           V::set1 (1.0) - zz * V::set1 (0.5));
+
+      const auto j2 = cmpEq (j, V::set1 (2.0));
+      const auto j4 = cmpEq (j, V::set1 (4.0));
+      const auto j6 = cmpEq (j, V::set1 (6.0));
+      const auto swap = V::maskOr (j2, j6);
+      const auto sinNeg = V::maskXor (V::maskOr (j4, j6), negative);
+      const auto cosNeg = V::maskOr (j2, j4);
+
+      const V rs = select (swap, pc, ps);
+      const V rc = select (swap, ps, pc);
+      s = select (sinNeg, zero - rs, rs);
+      c = select (cosNeg, zero - rc, rc);
+    }
+
+    // Cephes atanf: one polynomial, reduction at tan(3pi/8) and tan(pi/8)
+    template <class V> inline V vatanFloat (V x) {
+      static constexpr double P[] = { 8.05374449538E-2, -1.38776856032E-1, 1.99777106478E-1,
+                                      -3.33329491539E-1 };
+      const V zero = V::set1 (0.0);
+      const V one = V::set1 (1.0);
+      const auto negative = cmpLt (x, zero);
+      const V ax = vabs (x);
+
+      const auto big = cmpGt (ax, V::set1 (2.414213562373095));
+      const auto mid = cmpGt (ax, V::set1 (0.4142135623730950));
+      const V xr = select (big, zero - one / ax, select (mid, (ax - one) / (ax + one), ax));
+      const V y0 = select (big, V::set1 (kPi / 2.0), select (mid, V::set1 (kPi / 4.0), zero));
+
+      const V z = xr * xr;
+      const V r = y0 + vfmadd (polevl (z, P, 3) * z, xr, xr);
+      return select (negative, zero - r, r);
+    }
+
+    template <class V> inline V vatanDouble (V x) {
+      static constexpr double P[] = { -8.750608600031904122785E-1, -1.615753718733365076637E1,
+                                      -7.500855792314704667340E1, -1.228866684490136173410E2,
+                                      -6.485021904942025371773E1 };
+      static constexpr double Q[] = { 2.485846490142306297962E1, 1.650270098316988542046E2,
+                                      4.328810604912902668951E2, 4.853903996359136964868E2,
+                                      1.945506571482613964425E2 };
+      constexpr double moreBits = 6.123233995736765886130E-17;
+      const V zero = V::set1 (0.0);
+      const V one = V::set1 (1.0);
+      const auto negative = cmpLt (x, zero);
+      const V ax = vabs (x);
+
+      const auto big = cmpGt (ax, V::set1 (2.41421356237309504880));
+      const auto mid = cmpGt (ax, V::set1 (0.66));
+      const V xr = select (big, zero - one / ax, select (mid, (ax - one) / (ax + one), ax));
+      const V y0 = select (big, V::set1 (kPi / 2.0), select (mid, V::set1 (kPi / 4.0), zero));
+      const V more
+          = select (big, V::set1 (moreBits), select (mid, V::set1 (0.5 * moreBits), zero));
+
+      const V z = xr * xr;
+      const V p = z * polevl (z, P, 4) / p1evl (z, Q, 5);
+      const V r = y0 + (vfmadd (xr, p, xr) + more);
+      return select (negative, zero - r, r);
+    }
+
+    template <class V> inline V vatan (V x) {
+      if constexpr (std::is_same<typename V::Scalar, float>::value)
+        return vatanFloat (x);
+      else
+        return vatanDouble (x);
+    }
+
+    template <class V> inline V vatan2 (V y, V x) {
+      const V zero = V::set1 (0.0);
+      const V a = vatan (y / x);
+      const V shift = select (cmpLt (y, zero), V::set1 (-kPi), V::set1 (kPi));
+      return select (cmpLt (x, zero), a + shift, a);
+    }
+
+    // acos over [-1, 1] through atan2, which stays accurate near +-1
+    template <class V> inline V vacos (V x) {
+      const V one = V::set1 (1.0);
+      return vatan2 (vsqrt ((one - x) * (one + x)), x);
+    }
+
+    // Float reduces by multiples of 90 degrees instead, which is exact: converting the
+    // whole angle to radians would round it to ~1e-7 relative, enough to move cos near
+    // +-90 (latitudes, declination) by whole ulps of the result.
+    template <class V> inline void vsincosdFloat (V x, V& s, V& c) {
+      using K = SinCosCoefficients<float>;
+      const V zero = V::set1 (0.0);
+      const V q = vfloor (vfmadd (x, V::set1 (1.0 / 90.0), V::set1 (0.5)));
+      const V z = (x - q * V::set1 (90.0)) * V::set1 (kDegrad);
+      const V j = q - V::set1 (4.0) * vfloor (q * V::set1 (0.25));
+      const V zz = z * z;
+
+      const V ps = vfmadd (z * zz, polevl (zz, K::sincof, K::degree), z);
+      const V pc = vfmadd (zz * zz, polevl (zz, K::coscof, K::degree),
+                           V::set1 (1.0) - zz * V::set1 (0.5));
+
+      const auto j1 = cmpEq (j, V::set1 (1.0));
+      const auto j2 = cmpEq (j, V::set1 (2.0));
+      const auto j3 = cmpEq (j, V::set1 (3.0));
+      const auto swap = V::maskOr (j1, j3);
+      const V rs = select (swap, pc, ps);
+      const V rc = select (swap, ps, pc);
+      s = select (V::maskOr (j2, j3), zero - rs, rs);
+      c = select (V::maskOr (j1, j2), zero - rc, rc);
+    }
+
+    template <class V> inline void vsincosd (V x, V& s, V& c) {
+      if constexpr (std::is_same<typename V::Scalar, float>::value)
+        vsincosdFloat (x, s, c);
+      else
+        vsincos (x * V::set1 (kDegrad), s, c);
+    }
+
+    template <class V> inline V vatan2d (V y, V x) {
+      return V::set1 (kRadeg) * vatan2 (y, x);
+    }
+
+    template <class V> inline V vacosd (V x) {
+      return V::set1 (kRadeg) * vacos (x);
+    }
+
+    template <class V> inline V vrevolution (V x) {
+      return x - V::set1 (360.0) * vfloor (x * V::set1 (1.0 / 360.0));
+    }
+
+    template <class V> inline V vrev180 (V x) {
+      return x - V::set1 (360.0) * vfloor (vfmadd (x, V::set1 (1.0 / 360.0), V::set1 (0.5)));
+    }
+
+  } // namespace simd
+} // namespace dotname
+
+#endif // __SIMDMATH_HPP
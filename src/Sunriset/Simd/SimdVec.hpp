@@ -0,0 +1,601 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __SIMDVEC_HPP
+#define __SIMDVEC_HPP
+
+// Thin wrappers over the x86 vector registers used by the generic kernels in
+// SimdMath.hpp / SunrisetKernel.hpp, in double (Vec*) and float (Vec*F) flavours. Each wrapper only exists when the translation
+// unit is compiled with the matching instruction set (see the SIMD block in
+// CMakeLists.txt), so the kernels are instantiated once per Kernel*.cpp file.
+
+#include <cmath>
+#include <cstddef>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #define SUNRISET_SIMD_SSE2 1
+  #include <emmintrin.h>
+#endif
+#if defined(__AVX2__)
+  #define SUNRISET_SIMD_AVX2 1
+  #include <immintrin.h>
+#endif
+#if defined(__AVX512F__) && defined(__AVX512DQ__)
+  #define SUNRISET_SIMD_AVX512 1
+  #include <immintrin.h>
+#endif
+
+namespace dotname {
+  namespace simd {
+
+    // One float lane with the vector interface, the portable fallback of the
+    // single-precision kernel
+    struct VecScalarF {
+      using Scalar = float;
+      using Mask = bool;
+      static constexpr std::size_t width = 1;
+      float v;
+
+      static VecScalarF set1 (double x) {
+        return { static_cast<float> (x) };
+      }
+      static VecScalarF load (const float* p) {
+        return { *p };
+      }
+      void store (float* p) const {
+        *p = v;
+      }
+
+      friend VecScalarF operator+ (VecScalarF a, VecScalarF b) {
+        return { a.v + b.v };
+      }
+      friend VecScalarF operator- (VecScalarF a, VecScalarF b) {
+        return { a.v - b.v };
+      }
+      friend VecScalarF operator* (VecScalarF a, VecScalarF b) {
+        return { a.v * b.v };
+      }
+      friend VecScalarF operator/ (VecScalarF a, VecScalarF b) {
+        return { a.v / b.v };
+      }
+      friend VecScalarF vfmadd (VecScalarF a, VecScalarF b, VecScalarF c) {
+        return { a.v * b.v + c.v };
+      }
+      friend VecScalarF vsqrt (VecScalarF a) {
+        return { std::sqrt (a.v) };
+      }
+      friend VecScalarF vabs (VecScalarF a) {
+        return { std::fabs (a.v) };
+      }
+      friend VecScalarF vmin (VecScalarF a, VecScalarF b) {
+        return { a.v < b.v ? a.v : b.v };
+      }
+      friend VecScalarF vmax (VecScalarF a, VecScalarF b) {
+        return { a.v > b.v ? a.v : b.v };
+      }
+      friend VecScalarF vfloor (VecScalarF a) {
+        return { std::floor (a.v) };
+      }
+
+      friend Mask cmpLt (VecScalarF a, VecScalarF b) {
+        return a.v < b.v;
+      }
+      friend Mask cmpLe (VecScalarF a, VecScalarF b) {
+        return a.v <= b.v;
+      }
+      friend Mask cmpGt (VecScalarF a, VecScalarF b) {
+        return a.v > b.v;
+      }
+      friend Mask cmpGe (VecScalarF a, VecScalarF b) {
+        return a.v >= b.v;
+      }
+      friend Mask cmpEq (VecScalarF a, VecScalarF b) {
+        return a.v == b.v;
+      }
+      static Mask maskOr (Mask a, Mask b) {
+        return a || b;
+      }
+      static Mask maskAnd (Mask a, Mask b) {
+        return a && b;
+      }
+      static Mask maskXor (Mask a, Mask b) {
+        return a != b;
+      }
+      friend VecScalarF select (Mask m, VecScalarF a, VecScalarF b) {
+        return m ? a : b;
+      }
+    };
+
+#if defined(SUNRISET_SIMD_SSE2)
+    struct VecSse2 {
+      using Scalar = double;
+      using Mask = __m128d;
+      static constexpr std::size_t width = 2;
+      __m128d v;
+
+      static VecSse2 set1 (double x) {
+        return { _mm_set1_pd (x) };
+      }
+      static VecSse2 load (const double* p) {
+        return { _mm_loadu_pd (p) };
+      }
+      void store (double* p) const {
+        _mm_storeu_pd (p, v);
+      }
+
+      friend VecSse2 operator+ (VecSse2 a, VecSse2 b) {
+        return { _mm_add_pd (a.v, b.v) };
+      }
+      friend VecSse2 operator- (VecSse2 a, VecSse2 b) {
+        return { _mm_sub_pd (a.v, b.v) };
+      }
+      friend VecSse2 operator* (VecSse2 a, VecSse2 b) {
+        return { _mm_mul_pd (a.v, b.v) };
+      }
+      friend VecSse2 operator/ (VecSse2 a, VecSse2 b) {
+        return { _mm_div_pd (a.v, b.v) };
+      }
+      friend VecSse2 vfmadd (VecSse2 a, VecSse2 b, VecSse2 c) {
+        return { _mm_add_pd (_mm_mul_pd (a.v, b.v), c.v) };
+      }
+      friend VecSse2 vsqrt (VecSse2 a) {
+        return { _mm_sqrt_pd (a.v) };
+      }
+      friend VecSse2 vabs (VecSse2 a) {
+        return { _mm_andnot_pd (_mm_set1_pd (-0.0), a.v) };
+      }
+      friend VecSse2 vmin (VecSse2 a, VecSse2 b) {
+        return { _mm_min_pd (a.v, b.v) };
+      }
+      friend VecSse2 vmax (VecSse2 a, VecSse2 b) {
+        return { _mm_max_pd (a.v, b.v) };
+      }
+      // SSE2 has no rounding instruction: round through the 2^52 trick, then fix up
+      // the lanes that were rounded up. Valid for |x| < 2^51, far beyond any angle here.
+      friend VecSse2 vfloor (VecSse2 a) {
+        const __m128d magic = _mm_or_pd (_mm_set1_pd (4503599627370496.0),
+                                         _mm_and_pd (a.v, _mm_set1_pd (-0.0)));
+        const __m128d r = _mm_sub_pd (_mm_add_pd (a.v, magic), magic);
+        const __m128d up = _mm_cmpgt_pd (r, a.v);
+        return { _mm_sub_pd (r, _mm_and_pd (up, _mm_set1_pd (1.0))) };
+      }
+
+      friend Mask cmpLt (VecSse2 a, VecSse2 b) {
+        return _mm_cmplt_pd (a.v, b.v);
+      }
+      friend Mask cmpLe (VecSse2 a, VecSse2 b) {
+        return _mm_cmple_pd (a.v, b.v);
+      }
+      friend Mask cmpGt (VecSse2 a, VecSse2 b) {
+        return _mm_cmpgt_pd (a.v, b.v);
+      }
+      friend Mask cmpGe (VecSse2 a, VecSse2 b) {
+        return _mm_cmpge_pd (a.v, b.v);
+      }
+      friend Mask cmpEq (VecSse2 a, VecSse2 b) {
+        return _mm_cmpeq_pd (a.v, b.v);
+      }
+      static Mask maskOr (Mask a, Mask b) {
+        return _mm_or_pd (a, b);
+      }
+      static Mask maskAnd (Mask a, Mask b) {
+        return _mm_and_pd (a, b);
+      }
+      static Mask maskXor (Mask a, Mask b) {
+        return _mm_xor_pd (a, b);
+      }
+      // lanes where m is set take a, the others take b
+      friend VecSse2 select (Mask m, VecSse2 a, VecSse2 b) {
+        return { _mm_or_pd (_mm_and_pd (m, a.v), _mm_andnot_pd (m, b.v)) };
+      }
+    };
+
+    struct VecSse2F {
+      using Scalar = float;
+      using Mask = __m128;
+      static constexpr std::size_t width = 4;
+      __m128 v;
+
+      static VecSse2F set1 (double x) {
+        return { _mm_set1_ps (static_cast<float> (x)) };
+      }
+      static VecSse2F load (const float* p) {
+        return { _mm_loadu_ps (p) };
+      }
+      void store (float* p) const {
+        _mm_storeu_ps (p, v);
+      }
+
+      friend VecSse2F operator+ (VecSse2F a, VecSse2F b) {
+        return { _mm_add_ps (a.v, b.v) };
+      }
+      friend VecSse2F operator- (VecSse2F a, VecSse2F b) {
+        return { _mm_sub_ps (a.v, b.v) };
+      }
+      friend VecSse2F operator* (VecSse2F a, VecSse2F b) {
+        return { _mm_mul_ps (a.v, b.v) };
+      }
+      friend VecSse2F operator/ (VecSse2F a, VecSse2F b) {
+        return { _mm_div_ps (a.v, b.v) };
+      }
+      friend VecSse2F vfmadd (VecSse2F a, VecSse2F b, VecSse2F c) {
+        return { _mm_add_ps (_mm_mul_ps (a.v, b.v), c.v) };
+      }
+      friend VecSse2F vsqrt (VecSse2F a) {
+        return { _mm_sqrt_ps (a.v) };
+      }
+      friend VecSse2F vabs (VecSse2F a) {
+        return { _mm_andnot_ps (_mm_set1_ps (-0.0f), a.v) };
+      }
+      friend VecSse2F vmin (VecSse2F a, VecSse2F b) {
+        return { _mm_min_ps (a.v, b.v) };
+      }
+      friend VecSse2F vmax (VecSse2F a, VecSse2F b) {
+        return { _mm_max_ps (a.v, b.v) };
+      }
+      // Same rounding trick as VecSse2 with 2^23, valid for |x| < 2^22
+      friend VecSse2F vfloor (VecSse2F a) {
+        const __m128 magic
+            = _mm_or_ps (_mm_set1_ps (8388608.0f), _mm_and_ps (a.v, _mm_set1_ps (-0.0f)));
+        const __m128 r = _mm_sub_ps (_mm_add_ps (a.v, magic), magic);
+        const __m128 up = _mm_cmpgt_ps (r, a.v);
+        return { _mm_sub_ps (r, _mm_and_ps (up, _mm_set1_ps (1.0f))) };
+      }
+
+      friend Mask cmpLt (VecSse2F a, VecSse2F b) {
+        return _mm_cmplt_ps (a.v, b.v);
+      }
+      friend Mask cmpLe (VecSse2F a, VecSse2F b) {
+        return _mm_cmple_ps (a.v, b.v);
+      }
+      friend Mask cmpGt (VecSse2F a, VecSse2F b) {
+        return _mm_cmpgt_ps (a.v, b.v);
+      }
+      friend Mask cmpGe (VecSse2F a, VecSse2F b) {
+        return _mm_cmpge_ps (a.v, b.v);
+      }
+      friend Mask cmpEq (VecSse2F a, VecSse2F b) {
+        return _mm_cmpeq_ps (a.v, b.v);
+      }
+      static Mask maskOr (Mask a, Mask b) {
+        return _mm_or_ps (a, b);
+      }
+      static Mask maskAnd (Mask a, Mask b) {
+        return _mm_and_ps (a, b);
+      }
+      static Mask maskXor (Mask a, Mask b) {
+        return _mm_xor_ps (a, b);
+      }
+      friend VecSse2F select (Mask m, VecSse2F a, VecSse2F b) {
+        return { _mm_or_ps (_mm_and_ps (m, a.v), _mm_andnot_ps (m, b.v)) };
+      }
+    };
+#endif
+
+#if defined(SUNRISET_SIMD_AVX2)
+    struct VecAvx2 {
+      using Scalar = double;
+      using Mask = __m256d;
+      static constexpr std::size_t width = 4;
+      __m256d v;
+
+      static VecAvx2 set1 (double x) {
+        return { _mm256_set1_pd (x) };
+      }
+      static VecAvx2 load (const double* p) {
+        return { _mm256_loadu_pd (p) };
+      }
+      void store (double* p) const {
+        _mm256_storeu_pd (p, v);
+      }
+
+      friend VecAvx2 operator+ (VecAvx2 a, VecAvx2 b) {
+        return { _mm256_add_pd (a.v, b.v) };
+      }
+      friend VecAvx2 operator- (VecAvx2 a, VecAvx2 b) {
+        return { _mm256_sub_pd (a.v, b.v) };
+      }
+      friend VecAvx2 operator* (VecAvx2 a, VecAvx2 b) {
+        return { _mm256_mul_pd (a.v, b.v) };
+      }
+      friend VecAvx2 operator/ (VecAvx2 a, VecAvx2 b) {
+        return { _mm256_div_pd (a.v, b.v) };
+      }
+      friend VecAvx2 vfmadd (VecAvx2 a, VecAvx2 b, VecAvx2 c) {
+  #if defined(__FMA__)
+        return { _mm256_fmadd_pd (a.v, b.v, c.v) };
+  #else
+        return { _mm256_add_pd (_mm256_mul_pd (a.v, b.v), c.v) };
+  #endif
+      }
+      friend VecAvx2 vsqrt (VecAvx2 a) {
+        return { _mm256_sqrt_pd (a.v) };
+      }
+      friend VecAvx2 vabs (VecAvx2 a) {
+        return { _mm256_andnot_pd (_mm256_set1_pd (-0.0), a.v) };
+      }
+      friend VecAvx2 vmin (VecAvx2 a, VecAvx2 b) {
+        return { _mm256_min_pd (a.v, b.v) };
+      }
+      friend VecAvx2 vmax (VecAvx2 a, VecAvx2 b) {
+        return { _mm256_max_pd (a.v, b.v) };
+      }
+      friend VecAvx2 vfloor (VecAvx2 a) {
+        return { _mm256_floor_pd (a.v) };
+      }
+
+      friend Mask cmpLt (VecAvx2 a, VecAvx2 b) {
+        return _mm256_cmp_pd (a.v, b.v, _CMP_LT_OQ);
+      }
+      friend Mask cmpLe (VecAvx2 a, VecAvx2 b) {
+        return _mm256_cmp_pd (a.v, b.v, _CMP_LE_OQ);
+      }
+      friend Mask cmpGt (VecAvx2 a, VecAvx2 b) {
+        return _mm256_cmp_pd (a.v, b.v, _CMP_GT_OQ);
+      }
+      friend Mask cmpGe (VecAvx2 a, VecAvx2 b) {
+        return _mm256_cmp_pd (a.v, b.v, _CMP_GE_OQ);
+      }
+      friend Mask cmpEq (VecAvx2 a, VecAvx2 b) {
+        return _mm256_cmp_pd (a.v, b.v, _CMP_EQ_OQ);
+      }
+      static Mask maskOr (Mask a, Mask b) {
+        return _mm256_or_pd (a, b);
+      }
+      static Mask maskAnd (Mask a, Mask b) {
+        return _mm256_and_pd (a, b);
+      }
+      static Mask maskXor (Mask a, Mask b) {
+        return _mm256_xor_pd (a, b);
+      }
+      friend VecAvx2 select (Mask m, VecAvx2 a, VecAvx2 b) {
+        return { _mm256_blendv_pd (b.v, a.v, m) };
+      }
+    };
+
+    struct VecAvx2F {
+      using Scalar = float;
+      using Mask = __m256;
+      static constexpr std::size_t width = 8;
+      __m256 v;
+
+      static VecAvx2F set1 (double x) {
+        return { _mm256_set1_ps (static_cast<float> (x)) };
+      }
+      static VecAvx2F load (const float* p) {
+        return { _mm256_loadu_ps (p) };
+      }
+      void store (float* p) const {
+        _mm256_storeu_ps (p, v);
+      }
+
+      friend VecAvx2F operator+ (VecAvx2F a, VecAvx2F b) {
+        return { _mm256_add_ps (a.v, b.v) };
+      }
+      friend VecAvx2F operator- (VecAvx2F a, VecAvx2F b) {
+        return { _mm256_sub_ps (a.v, b.v) };
+      }
+      friend VecAvx2F operator* (VecAvx2F a, VecAvx2F b) {
+        return { _mm256_mul_ps (a.v, b.v) };
+      }
+      friend VecAvx2F operator/ (VecAvx2F a, VecAvx2F b) {
+        return { _mm256_div_ps (a.v, b.v) };
+      }
+      friend VecAvx2F vfmadd (VecAvx2F a, VecAvx2F b, VecAvx2F c) {
+  #if defined(__FMA__)
+        return { _mm256_fmadd_ps (a.v, b.v, c.v) };
+  #else
+        return { _mm256_add_ps (_mm256_mul_ps (a.v, b.v), c.v) };
+  #endif
+      }
+      friend VecAvx2F vsqrt (VecAvx2F a) {
+        return { _mm256_sqrt_ps (a.v) };
+      }
+      friend VecAvx2F vabs (VecAvx2F a) {
+        return { _mm256_andnot_ps (_mm256_set1_ps (-0.0f), a.v) };
+      }
+      friend VecAvx2F vmin (VecAvx2F a, VecAvx2F b) {
+        return { _mm256_min_ps (a.v, b.v) };
+      }
+      friend VecAvx2F vmax (VecAvx2F a, VecAvx2F b) {
+        return { _mm256_max_ps (a.v, b.v) };
+      }
+      friend VecAvx2F vfloor (VecAvx2F a) {
+        return { _mm256_floor_ps (a.v) };
+      }
+
+      friend Mask cmpLt (VecAvx2F a, VecAvx2F b) {
+        return _mm256_cmp_ps (a.v, b.v, _CMP_LT_OQ);
+      }
+      friend Mask cmpLe (VecAvx2F a, VecAvx2F b) {
+        return _mm256_cmp_ps (a.v, b.v, _CMP_LE_OQ);
+      }
+      friend Mask cmpGt (VecAvx2F a, VecAvx2F b) {
+        return _mm256_cmp_ps (a.v, b.v, _CMP_GT_OQ);
+      }
+      friend Mask cmpGe (VecAvx2F a, VecAvx2F b) {
+        return _mm256_cmp_ps (a.v, b.v, _CMP_GE_OQ);
+      }
+      friend Mask cmpEq (VecAvx2F a, VecAvx2F b) {
+        return _mm256_cmp_ps (a.v, b.v, _CMP_EQ_OQ);
+      }
+      static Mask maskOr (Mask a, Mask b) {
+        return _mm256_or_ps (a, b);
+      }
+      static Mask maskAnd (Mask a, Mask b) {
+        return _mm256_and_ps (a, b);
+      }
+      static Mask maskXor (Mask a, Mask b) {
+        return _mm256_xor_ps (a, b);
+      }
+      friend VecAvx2F select (Mask m, VecAvx2F a, VecAvx2F b) {
+        return { _mm256_blendv_ps (b.v, a.v, m) };
+      }
+    };
+#endif
+
+#if defined(SUNRISET_SIMD_AVX512)
+    struct VecAvx512 {
+      using Scalar = double;
+      using Mask = __mmask8;
+      static constexpr std::size_t width = 8;
+      // All lanes. sqrt/min/max/floor use the masked intrinsics with the input as the
+      // pass-through: the unmasked ones in GCC 12's avx512fintrin.h pass an uninitialized
+      // source and trip -Wmaybe-uninitialized wherever they are inlined (also under LTO).
+      static constexpr Mask kAll = 0xFF;
+      __m512d v;
+
+      static VecAvx512 set1 (double x) {
+        return { _mm512_set1_pd (x) };
+      }
+      static VecAvx512 load (const double* p) {
+        return { _mm512_loadu_pd (p) };
+      }
+      void store (double* p) const {
+        _mm512_storeu_pd (p, v);
+      }
+
+      friend VecAvx512 operator+ (VecAvx512 a, VecAvx512 b) {
+        return { _mm512_add_pd (a.v, b.v) };
+      }
+      friend VecAvx512 operator- (VecAvx512 a, VecAvx512 b) {
+        return { _mm512_sub_pd (a.v, b.v) };
+      }
+      friend VecAvx512 operator* (VecAvx512 a, VecAvx512 b) {
+        return { _mm512_mul_pd (a.v, b.v) };
+      }
+      friend VecAvx512 operator/ (VecAvx512 a, VecAvx512 b) {
+        return { _mm512_div_pd (a.v, b.v) };
+      }
+      friend VecAvx512 vfmadd (VecAvx512 a, VecAvx512 b, VecAvx512 c) {
+        return { _mm512_fmadd_pd (a.v, b.v, c.v) };
+      }
+      friend VecAvx512 vsqrt (VecAvx512 a) {
+        return { _mm512_mask_sqrt_pd (a.v, kAll, a.v) };
+      }
+      friend VecAvx512 vabs (VecAvx512 a) {
+        return { _mm512_abs_pd (a.v) };
+      }
+      friend VecAvx512 vmin (VecAvx512 a, VecAvx512 b) {
+        return { _mm512_mask_min_pd (a.v, kAll, a.v, b.v) };
+      }
+      friend VecAvx512 vmax (VecAvx512 a, VecAvx512 b) {
+        return { _mm512_mask_max_pd (a.v, kAll, a.v, b.v) };
+      }
+      friend VecAvx512 vfloor (VecAvx512 a) {
+        return { _mm512_mask_roundscale_pd (a.v, kAll, a.v,
+                                             _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC) };
+      }
+
+      friend Mask cmpLt (VecAvx512 a, VecAvx512 b) {
+        return _mm512_cmp_pd_mask (a.v, b.v, _CMP_LT_OQ);
+      }
+      friend Mask cmpLe (VecAvx512 a, VecAvx512 b) {
+        return _mm512_cmp_pd_mask (a.v, b.v, _CMP_LE_OQ);
+      }
+      friend Mask cmpGt (VecAvx512 a, VecAvx512 b) {
+        return _mm512_cmp_pd_mask (a.v, b.v, _CMP_GT_OQ);
+      }
+      friend Mask cmpGe (VecAvx512 a, VecAvx512 b) {
+        return _mm512_cmp_pd_mask (a.v, b.v, _CMP_GE_OQ);
+      }
+      friend Mask cmpEq (VecAvx512 a, VecAvx512 b) {
+        return _mm512_cmp_pd_mask (a.v, b.v, _CMP_EQ_OQ);
+      }
+      static Mask maskOr (Mask a, Mask b) {
+        return static_cast<Mask> (a | b);
+      }
+      static Mask maskAnd (Mask a, Mask b) {
+        return static_cast<Mask> (a & b);
+      }
+      static Mask maskXor (Mask a, Mask b) {
+        return static_cast<Mask> (a ^ b);
+      }
+      friend VecAvx512 select (Mask m, VecAvx512 a, VecAvx512 b) {
+        return { _mm512_mask_blend_pd (m, b.v, a.v) };
+      }
+    };
+
+    struct VecAvx512F {
+      using Scalar = float;
+      using Mask = __mmask16;
+      static constexpr std::size_t width = 16;
+      static constexpr Mask kAll = 0xFFFF; // see VecAvx512::kAll
+      __m512 v;
+
+      static VecAvx512F set1 (double x) {
+        return { _mm512_set1_ps (static_cast<float> (x)) };
+      }
+      static VecAvx512F load (const float* p) {
+        return { _mm512_loadu_ps (p) };
+      }
+      void store (float* p) const {
+        _mm512_storeu_ps (p, v);
+      }
+
+      friend VecAvx512F operator+ (VecAvx512F a, VecAvx512F b) {
+        return { _mm512_add_ps (a.v, b.v) };
+      }
+      friend VecAvx512F operator- (VecAvx512F a, VecAvx512F b) {
+        return { _mm512_sub_ps (a.v, b.v) };
+      }
+      friend VecAvx512F operator* (VecAvx512F a, VecAvx512F b) {
+        return { _mm512_mul_ps (a.v, b.v) };
+      }
+      friend VecAvx512F operator/ (VecAvx512F a, VecAvx512F b) {
+        return { _mm512_div_ps (a.v, b.v) };
+      }
+      friend VecAvx512F vfmadd (VecAvx512F a, VecAvx512F b, VecAvx512F c) {
+        return { _mm512_fmadd_ps (a.v, b.v, c.v) };
+      }
+      friend VecAvx512F vsqrt (VecAvx512F a) {
+        return { _mm512_mask_sqrt_ps (a.v, kAll, a.v) };
+      }
+      friend VecAvx512F vabs (VecAvx512F a) {
+        return { _mm512_abs_ps (a.v) };
+      }
+      friend VecAvx512F vmin (VecAvx512F a, VecAvx512F b) {
+        return { _mm512_mask_min_ps (a.v, kAll, a.v, b.v) };
+      }
+      friend VecAvx512F vmax (VecAvx512F a, VecAvx512F b) {
+        return { _mm512_mask_max_ps (a.v, kAll, a.v, b.v) };
+      }
+      friend VecAvx512F vfloor (VecAvx512F a) {
+        return { _mm512_mask_roundscale_ps (a.v, kAll, a.v,
+                                             _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC) };
+      }
+
+      friend Mask cmpLt (VecAvx512F a, VecAvx512F b) {
+        return _mm512_cmp_ps_mask (a.v, b.v, _CMP_LT_OQ);
+      }
+      friend Mask cmpLe (VecAvx512F a, VecAvx512F b) {
+        return _mm512_cmp_ps_mask (a.v, b.v, _CMP_LE_OQ);
+      }
+      friend Mask cmpGt (VecAvx512F a, VecAvx512F b) {
+        return _mm512_cmp_ps_mask (a.v, b.v, _CMP_GT_OQ);
+      }
+      friend Mask cmpGe (VecAvx512F a, VecAvx512F b) {
+        return _mm512_cmp_ps_mask (a.v, b.v, _CMP_GE_OQ);
+      }
+      friend Mask cmpEq (VecAvx512F a, VecAvx512F b) {
+        return _mm512_cmp_ps_mask (a.v, b.v, _CMP_EQ_OQ);
+      }
+      static Mask maskOr (Mask a, Mask b) {
+        return static_cast<Mask> (a | b);
+      }
+      static Mask maskAnd (Mask a, Mask b) {
+        return static_cast<Mask> (a & b);
+      }
+      static Mask maskXor (Mask a, Mask b) {
+        return static_cast<Mask> (a ^ b);
+      }
+      friend VecAvx512F select (Mask m, VecAvx512F a, VecAvx512F b) {
+        return { _mm512_mask_blend_ps (m, b.v, a.v) };
+      }
+    };
+#endif
+
+  } // namespace simd
+} // namespace dotname
+
+#endif // __SIMDVEC_HPP
@@ -0,0 +1,212 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __SUNRISETKERNEL_HPP
+#define __SUNRISETKERNEL_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <Sunriset/Batch.hpp>
+
+#include "Sunriset/Simd/SimdMath.hpp"
+
+namespace dotname {
+  namespace simd {
+
+    struct SunrisetKernelArgs {
+      long days;              // days_since_2000_Jan_0 of the first element
+      double dayStep;         // days between consecutive elements, 0 for a single date
+      const double* lon;
+      const double* lat;
+      bool broadcastLocation; // lon/lat point to one observer shared by all elements
+      // Precomputed sind/cosd (lat) and lon / 360 per element (LocationSet), lat unused;
+      // nullptr to derive them from lon/lat
+      const double* sinLat = nullptr;
+      const double* cosLat = nullptr;
+      const double* lonFraction = nullptr;
+      double altit;
+      bool upperLimb;
+      double* rise;
+      double* set;
+      std::int8_t* status; // may be nullptr
+      std::size_t count;
+    };
+
+    using SunrisetKernelFn = void (*) (const SunrisetKernelArgs&);
+
+    // Per instruction set entry points, nullptr when the build has no such kernel
+    SunrisetKernelFn sunrisetKernelSse2 ();
+    SunrisetKernelFn sunrisetKernelAvx2 ();
+    SunrisetKernelFn sunrisetKernelAvx512 ();
+
+    // Resolves `level` against the CPU, fills altit/upperLimb for `event` and runs the
+    // kernel; false when only the scalar path is left
+    bool runSunrisetKernel (SimdLevel level, SunrisetKernelArgs& args, SolarEvent event);
+
+    // The part of __sunriset__ after the time dependent angles (sidereal time, mean
+    // anomaly M, perihelion w, eccentricity e, obliquity), shared by the double and the
+    // float kernel. Differs from the scalar code in:
+    //  - sin/cos of the declination come from the rectangular coordinates instead of
+    //    atan2 followed by sind/cosd (same value, two trig calls fewer),
+    //  - the polar branches on cost are resolved with lane selects.
+    template <class V>
+    inline void sunrisetFromAngles (double altitude, bool upperLimb, V sidtime, V M, V w, V e,
+                                    V obl, V sinLat, V cosLat, V& rise, V& set, V& rc) {
+      const V zero = V::set1 (0.0);
+      const V one = V::set1 (1.0);
+
+      // sunpos
+      V sinM, cosM;
+      vsincosd (M, sinM, cosM);
+      const V E = M + e * V::set1 (kRadeg) * sinM * vfmadd (e, cosM, one);
+      V sinE, cosE;
+      vsincosd (E, sinE, cosE);
+      const V x = cosE - e;
+      const V y = vsqrt (one - e * e) * sinE;
+      const V r = vsqrt (vfmadd (x, x, y * y));
+      const V slon = vatan2d (y, x) + w;
+
+      // sun_RA_dec
+      V sinL, cosL;
+      vsincosd (slon, sinL, cosL);
+      V sinO, cosO;
+      vsincosd (obl, sinO, cosO);
+      const V xe = r * cosL;
+      const V ys = r * sinL;
+      const V ye = ys * cosO;
+      const V ze = ys * sinO;
+      const V ra = vatan2d (ye, xe);
+      const V sinDec = ze / r;
+      const V cosDec = vsqrt (vfmadd (xe, xe, ye * ye)) / r;
+
+      const V tsouth = V::set1 (12.0) - vrev180 (sidtime - ra) * V::set1 (1.0 / 15.0);
+
+      V altit = V::set1 (altitude);
+      if (upperLimb)
+        altit = altit - V::set1 (0.2666) / r;
+      V sinAlt, cosAlt;
+      vsincosd (altit, sinAlt, cosAlt);
+
+      // cos (+-90) rounds to 6e-17 in double but can come out -0 or negative in float,
+      // which would flip polar day and night; the floor keeps the C code's sign
+      const V cost = (sinAlt - sinLat * sinDec) / (vmax (cosLat, V::set1 (1e-30)) * cosDec);
+      const auto below = cmpGe (cost, one);
+      const auto above = cmpLe (cost, zero - one);
+      const V arc = vacosd (vmax (vmin (cost, one), zero - one)) * V::set1 (1.0 / 15.0);
+      const V t = select (below, zero, select (above, V::set1 (12.0), arc));
+
+      rise = tsouth - t;
+      set = tsouth + t;
+      rc = select (below, zero - one, select (above, one, zero));
+    }
+
+    // __sunriset__ over V::width observers at once, lonFraction = lon / 360
+    template <class V>
+    inline void sunrisetLanes (const SunrisetKernelArgs& a, V days, V lon, V lonFraction,
+                               V sinLat, V cosLat, V& rise, V& set, V& rc) {
+      const V d = days + V::set1 (0.5) - lonFraction;
+
+      // GMST0 and local sidereal time
+      const V sidtime = vrevolution (
+          vrevolution (vfmadd (d, V::set1 (0.9856002585 + 4.70935E-5),
+                               V::set1 (180.0 + 356.0470 + 282.9404)))
+          + V::set1 (180.0) + lon);
+
+      const V M = vrevolution (vfmadd (d, V::set1 (0.9856002585), V::set1 (356.0470)));
+      const V w = vfmadd (d, V::set1 (4.70935E-5), V::set1 (282.9404));
+      const V e = vfmadd (d, V::set1 (-1.151E-9), V::set1 (0.016709));
+      const V obl = vfmadd (d, V::set1 (-3.563E-7), V::set1 (23.4393));
+      sunrisetFromAngles (a.altit, a.upperLimb, sidtime, M, w, e, obl, sinLat, cosLat, rise,
+                          set, rc);
+    }
+
+    template <class V>
+    inline void sunrisetLanes (const SunrisetKernelArgs& a, V days, V lon, V lat, V& rise,
+                               V& set, V& rc) {
+      V sinLat, cosLat;
+      vsincosd (lat, sinLat, cosLat);
+      sunrisetLanes (a, days, lon, lon * V::set1 (1.0 / 360.0), sinLat, cosLat, rise, set, rc);
+    }
+
+    // Lanes j .. j + W of the element arrays in `a`
+    template <class V>
+    inline void sunrisetLanesAt (const SunrisetKernelArgs& a, const double* lon,
+                                 const double* lat, const double* lonFraction,
+                                 const double* sinLat, const double* cosLat, V days, V& rise,
+                                 V& set, V& rc) {
+      if (a.sinLat)
+        sunrisetLanes (a, days, V::load (lon), V::load (lonFraction), V::load (sinLat),
+                       V::load (cosLat), rise, set, rc);
+      else
+        sunrisetLanes (a, days, V::load (lon), V::load (lat), rise, set, rc);
+    }
+
+    template <class V> inline void sunrisetKernel (const SunrisetKernelArgs& a) {
+      constexpr std::size_t W = V::width;
+      if (a.count == 0)
+        return;
+      std::size_t i = 0;
+      V rise, set, rc;
+      double rcLanes[W], laneDays[W];
+
+      // Day number of each lane, advanced by W * dayStep per iteration
+      for (std::size_t k = 0; k < W; ++k)
+        laneDays[k] = static_cast<double> (a.days) + a.dayStep * static_cast<double> (k);
+      V days = V::load (laneDays);
+      const V daysStep = V::set1 (a.dayStep * static_cast<double> (W));
+
+      const V lon0 = V::set1 (a.lon[0]);
+      const V lat0 = V::set1 (a.lat[0]);
+      const auto lonAt
+          = [&] (std::size_t j) { return a.broadcastLocation ? lon0 : V::load (a.lon + j); };
+      const auto latAt
+          = [&] (std::size_t j) { return a.broadcastLocation ? lat0 : V::load (a.lat + j); };
+
+      for (; i + W <= a.count; i += W, days = days + daysStep) {
+        if (a.sinLat)
+          sunrisetLanesAt (a, a.lon + i, nullptr, a.lonFraction + i, a.sinLat + i, a.cosLat + i,
+                           days, rise, set, rc);
+        else
+          sunrisetLanes (a, days, lonAt (i), latAt (i), rise, set, rc);
+        rise.store (a.rise + i);
+        set.store (a.set + i);
+        if (a.status) {
+          rc.store (rcLanes);
+          for (std::size_t k = 0; k < W; ++k)
+            a.status[i + k] = static_cast<std::int8_t> (rcLanes[k]);
+        }
+      }
+
+      // Tail goes through the same lanes so every element sees the same arithmetic
+      if (i < a.count) {
+        const std::size_t n = a.count - i;
+        double lon[W] = {}, lat[W] = {}, riseLanes[W], setLanes[W];
+        double lonFraction[W] = {}, sinLat[W] = {}, cosLat[W] = {};
+        for (std::size_t k = 0; k < n; ++k) {
+          lon[k] = a.broadcastLocation ? a.lon[0] : a.lon[i + k];
+          if (a.sinLat) {
+            lonFraction[k] = a.lonFraction[i + k];
+            sinLat[k] = a.sinLat[i + k];
+            cosLat[k] = a.cosLat[i + k];
+          } else {
+            lat[k] = a.broadcastLocation ? a.lat[0] : a.lat[i + k];
+          }
+        }
+        sunrisetLanesAt (a, lon, lat, lonFraction, sinLat, cosLat, days, rise, set, rc);
+        rise.store (riseLanes);
+        set.store (setLanes);
+        rc.store (rcLanes);
+        for (std::size_t k = 0; k < n; ++k) {
+          a.rise[i + k] = riseLanes[k];
+          a.set[i + k] = setLanes[k];
+          if (a.status)
+            a.status[i + k] = static_cast<std::int8_t> (rcLanes[k]);
+        }
+      }
+    }
+
+  } // namespace simd
+} // namespace dotname
+
+#endif // __SUNRISETKERNEL_HPP
@@ -0,0 +1,142 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __SUNRISETKERNELFLOAT_HPP
+#define __SUNRISETKERNELFLOAT_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <Sunriset/Batch.hpp>
+#include <Sunriset/SolarCore.hpp>
+
+#include "Sunriset/Simd/SunrisetKernel.hpp"
+
+namespace dotname {
+  namespace simd {
+
+    struct SunrisetKernelFloatArgs {
+      long days;              // days_since_2000_Jan_0 of the first element
+      float dayStep;          // days between consecutive elements, 0 for a single date
+      const float* lon;
+      const float* lat;
+      bool broadcastLocation; // lon/lat point to one observer shared by all elements
+      double altit;
+      bool upperLimb;
+      float* rise;
+      float* set;
+      std::int8_t* status; // may be nullptr
+      std::size_t count;
+    };
+
+    using SunrisetKernelFloatFn = void (*) (const SunrisetKernelFloatArgs&);
+
+    SunrisetKernelFloatFn sunrisetKernelFloatSse2 ();
+    SunrisetKernelFloatFn sunrisetKernelFloatAvx2 ();
+    SunrisetKernelFloatFn sunrisetKernelFloatAvx512 ();
+
+    // Like runSunrisetKernel, but always runs: without SIMD it takes the one-lane kernel
+    void runSunrisetKernelFloat (SimdLevel level, SunrisetKernelFloatArgs& args,
+                                 SolarEvent event);
+
+    // A float holds the day number (up to ~36500) only to ~0.004 days, so the time
+    // dependent angles are evaluated in double at the chunk's base instant and rounded
+    // once; the lanes then add their small offset (day offset - lon / 360) in float.
+    struct FloatDayBase {
+      float gmst0; // revolution (GMST0 without the +180 and longitude)
+      float M;     // mean anomaly, 0..360
+      float w;     // argument of perihelion
+      float e;     // eccentricity
+      float obl;   // obliquity of the ecliptic
+    };
+
+    inline FloatDayBase floatDayBase (double d) {
+      return { static_cast<float> (core::gmst0 (d)),
+               static_cast<float> (core::revolution (356.0470 + 0.9856002585 * d)),
+               static_cast<float> (282.9404 + 4.70935E-5 * d),
+               static_cast<float> (0.016709 - 1.151E-9 * d),
+               static_cast<float> (23.4393 - 3.563E-7 * d) };
+    }
+
+    template <class V>
+    inline void sunrisetLanesFloat (const SunrisetKernelFloatArgs& a, const FloatDayBase& b,
+                                    V offset, V lon, V lat, V& rise, V& set, V& rc) {
+      const V delta = offset - lon * V::set1 (1.0 / 360.0);
+      const V sidtime
+          = vrevolution (vrevolution (vfmadd (delta, V::set1 (0.9856002585 + 4.70935E-5),
+                                              V::set1 (b.gmst0)))
+                         + V::set1 (180.0) + lon);
+      const V M = vrevolution (vfmadd (delta, V::set1 (0.9856002585), V::set1 (b.M)));
+      const V w = vfmadd (delta, V::set1 (4.70935E-5), V::set1 (b.w));
+      const V e = vfmadd (delta, V::set1 (-1.151E-9), V::set1 (b.e));
+      const V obl = vfmadd (delta, V::set1 (-3.563E-7), V::set1 (b.obl));
+      V sinLat, cosLat;
+      vsincosd (lat, sinLat, cosLat);
+      sunrisetFromAngles (a.altit, a.upperLimb, sidtime, M, w, e, obl, sinLat, cosLat, rise,
+                          set, rc);
+    }
+
+    template <class V> inline void sunrisetKernelFloat (const SunrisetKernelFloatArgs& a) {
+      constexpr std::size_t W = V::width;
+      if (a.count == 0)
+        return;
+      std::size_t i = 0;
+      V rise, set, rc;
+      float rcLanes[W], offsets[W];
+
+      for (std::size_t k = 0; k < W; ++k)
+        offsets[k] = a.dayStep * static_cast<float> (k);
+      const V offset = V::load (offsets);
+      const auto baseAt = [&] (std::size_t j) {
+        return floatDayBase (static_cast<double> (a.days) + 0.5
+                             + static_cast<double> (a.dayStep) * static_cast<double> (j));
+      };
+      FloatDayBase base = baseAt (0);
+
+      const V lon0 = V::set1 (a.lon[0]);
+      const V lat0 = V::set1 (a.lat[0]);
+      const auto lonAt
+          = [&] (std::size_t j) { return a.broadcastLocation ? lon0 : V::load (a.lon + j); };
+      const auto latAt
+          = [&] (std::size_t j) { return a.broadcastLocation ? lat0 : V::load (a.lat + j); };
+
+      for (; i + W <= a.count; i += W) {
+        if (a.dayStep != 0.0f)
+          base = baseAt (i);
+        sunrisetLanesFloat (a, base, offset, lonAt (i), latAt (i), rise, set, rc);
+        rise.store (a.rise + i);
+        set.store (a.set + i);
+        if (a.status) {
+          rc.store (rcLanes);
+          for (std::size_t k = 0; k < W; ++k)
+            a.status[i + k] = static_cast<std::int8_t> (rcLanes[k]);
+        }
+      }
+
+      // Tail goes through the same lanes so every element sees the same arithmetic
+      if (i < a.count) {
+        const std::size_t n = a.count - i;
+        float lon[W] = {}, lat[W] = {}, riseLanes[W], setLanes[W];
+        for (std::size_t k = 0; k < n; ++k) {
+          lon[k] = a.broadcastLocation ? a.lon[0] : a.lon[i + k];
+          lat[k] = a.broadcastLocation ? a.lat[0] : a.lat[i + k];
+        }
+        if (a.dayStep != 0.0f)
+          base = baseAt (i);
+        sunrisetLanesFloat (a, base, offset, V::load (lon), V::load (lat), rise, set, rc);
+        rise.store (riseLanes);
+        set.store (setLanes);
+        rc.store (rcLanes);
+        for (std::size_t k = 0; k < n; ++k) {
+          a.rise[i + k] = riseLanes[k];
+          a.set[i + k] = setLanes[k];
+          if (a.status)
+            a.status[i + k] = static_cast<std::int8_t> (rcLanes[k]);
+        }
+      }
+    }
+
+  } // namespace simd
+} // namespace dotname
+
+#endif // __SUNRISETKERNELFLOAT_HPP
@@ -0,0 +1,77 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <Sunriset/SolarDay.hpp>
+#include <Sunriset/SolarCore.hpp>
+
+namespace dotname {
+
+  namespace {
+
+    // Upper limb altitude used by the day_length macro
+    constexpr double kDayLengthAltit = -50.0 / 60.0;
+
+    // Twilight thresholds refer to the Sun's center, so their sines are fixed
+    const double kSinCivil = core::sind (solarEventParams (SolarEvent::CivilTwilight).altit);
+    const double kSinNautical = core::sind (solarEventParams (SolarEvent::NauticalTwilight).altit);
+    const double kSinAstronomical
+        = core::sind (solarEventParams (SolarEvent::AstronomicalTwilight).altit);
+
+    SolarEventTimes toTimes (const core::SunTransit& tr, const core::DiurnalArc& arc) {
+      return { tr.tsouth - arc.t, tr.tsouth + arc.t, static_cast<std::int8_t> (arc.rc) };
+    }
+
+    SolarDay evaluate (long days, double lon, double lat) {
+      const core::SunTransit tr = core::sunTransit (days, lon);
+      const double sinLat = core::sind (lat);
+      const double cosLat = core::cosd (lat);
+
+      const double riseAltit
+          = solarEventParams (SolarEvent::SunriseSunset).altit - tr.sradius;
+      const core::DiurnalArc rise
+          = core::diurnalArc (core::sind (riseAltit), sinLat, cosLat, tr);
+      const core::DiurnalArc civil = core::diurnalArc (kSinCivil, sinLat, cosLat, tr);
+      const core::DiurnalArc nautical = core::diurnalArc (kSinNautical, sinLat, cosLat, tr);
+      const core::DiurnalArc astronomical
+          = core::diurnalArc (kSinAstronomical, sinLat, cosLat, tr);
+      const core::DiurnalArc day
+          = core::diurnalArc (core::sind (kDayLengthAltit - tr.sradius), sinLat, cosLat, tr);
+
+      SolarDay out;
+      out.solarNoon = tr.tsouth;
+      out.events[static_cast<std::size_t> (SolarEvent::SunriseSunset)] = toTimes (tr, rise);
+      out.events[static_cast<std::size_t> (SolarEvent::CivilTwilight)] = toTimes (tr, civil);
+      out.events[static_cast<std::size_t> (SolarEvent::NauticalTwilight)]
+          = toTimes (tr, nautical);
+      out.events[static_cast<std::size_t> (SolarEvent::AstronomicalTwilight)]
+          = toTimes (tr, astronomical);
+      out.dayLength = 2.0 * day.t;
+      out.civilTwilightLength = 2.0 * civil.t;
+      out.nauticalTwilightLength = 2.0 * nautical.t;
+      out.astronomicalTwilightLength = 2.0 * astronomical.t;
+      return out;
+    }
+
+  } // namespace
+
+  SolarDay solarDay (int year, int month, int day, double lon, double lat) {
+    return evaluate (core::daysSince2000Jan0 (year, month, day), lon, lat);
+  }
+
+  void solarDayBatch (int year, int month, int day, const double* lon, const double* lat,
+                      std::size_t count, SolarDay* out) {
+    const long days = core::daysSince2000Jan0 (year, month, day);
+    for (std::size_t i = 0; i < count; ++i) {
+      out[i] = evaluate (days, lon[i], lat[i]);
+    }
+  }
+
+  void solarDayRange (int year, int month, int day, std::size_t dayCount, double lon, double lat,
+                      SolarDay* out) {
+    long days = core::daysSince2000Jan0 (year, month, day);
+    for (std::size_t i = 0; i < dayCount; ++i, days = core::nextDay (days)) {
+      out[i] = evaluate (days, lon, lat);
+    }
+  }
+
+} // namespace dotname
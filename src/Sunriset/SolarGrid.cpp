@@ -0,0 +1,160 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <Sunriset/SolarGrid.hpp>
+
+#include "Sunriset/GridPlan.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace dotname {
+
+  namespace grid {
+
+    namespace {
+
+      double costOf (const core::SunTransit& tr, double sinAltit, double sinLat, double cosLat) {
+        return (sinAltit - sinLat * tr.sinDec) / (cosLat * tr.cosDec);
+      }
+
+      void store (std::size_t at, double tsouth, double t, int rc, double* rise, double* set,
+                  double* dayLength, std::int8_t* status) {
+        if (rise)
+          rise[at] = tsouth - t;
+        if (set)
+          set[at] = tsouth + t;
+        if (dayLength)
+          dayLength[at] = 2.0 * t;
+        if (status)
+          status[at] = static_cast<std::int8_t> (rc);
+      }
+
+    } // namespace
+
+    GridPlan::GridPlan (int year, int month, int day, const GridSpec& grid,
+                        const GridOptions& options, double* rise, double* set, double* dayLength,
+                        std::int8_t* status)
+        : grid_ (grid), options_ (options), days_ (core::daysSince2000Jan0 (year, month, day)),
+          params_ (solarEventParams (options.event)), rise_ (rise), set_ (set),
+          dayLength_ (dayLength), status_ (status), columns_ (grid.nLon), tsouth_ (grid.nLon),
+          x_ (grid.nLon), x2_ (grid.nLon) {
+      if (grid.nLon == 0)
+        return;
+
+      // Quadratic nodes at both ends and the middle of the longitude span, x in [-1, 1],
+      // plus two check nodes at x = -1/2 and 1/2 that measure how well each row fits
+      const double halfSpan = 0.5 * static_cast<double> (grid.nLon - 1) * grid.lonStep;
+      const double lonMid = grid.lon0 + halfSpan;
+      nodes_[0] = columnAt (lonMid - halfSpan);
+      nodes_[1] = columnAt (lonMid);
+      nodes_[2] = columnAt (lonMid + halfSpan);
+      nodes_[3] = columnAt (lonMid - 0.5 * halfSpan);
+      nodes_[4] = columnAt (lonMid + 0.5 * halfSpan);
+
+      for (std::size_t j = 0; j < grid.nLon; ++j) {
+        x_[j] = halfSpan != 0.0
+                    ? (static_cast<double> (j) * grid.lonStep - halfSpan) / halfSpan
+                    : 0.0;
+        x2_[j] = x_[j] * x_[j];
+      }
+    }
+
+    GridPlan::Column GridPlan::columnAt (double lon) const {
+      Column c;
+      c.transit = core::sunTransit (days_, lon);
+      c.sinAltit
+          = core::sind (params_.upperLimb ? params_.altit - c.transit.sradius : params_.altit);
+      return c;
+    }
+
+    // O(nLon): ephemeris per column
+    void GridPlan::prepareColumns (std::size_t begin, std::size_t end) {
+      for (std::size_t j = begin; j < end; ++j) {
+        columns_[j] = columnAt (grid_.lon0 + static_cast<double> (j) * grid_.lonStep);
+        tsouth_[j] = columns_[j].transit.tsouth;
+      }
+    }
+
+    void GridPlan::fillRows (std::size_t begin, std::size_t end) const {
+      const std::size_t nLon = grid_.nLon;
+      const double tolerance = options_.toleranceSeconds / 3600.0;
+      std::vector<double> t (nLon);
+
+      for (std::size_t i = begin; i < end; ++i) {
+        const double lat = grid_.lat0 + static_cast<double> (i) * grid_.latStep;
+        const double sinLat = core::sind (lat);
+        const double cosLat = core::cosd (lat);
+        const std::size_t row = i * nLon;
+
+        double tNode[5];
+        int rcNode[5];
+        for (int k = 0; k < 5; ++k) {
+          const double cost = costOf (nodes_[k].transit, nodes_[k].sinAltit, sinLat, cosLat);
+          if (cost >= 1.0)
+            tNode[k] = 0.0, rcNode[k] = -1;
+          else if (cost <= -1.0)
+            tNode[k] = 12.0, rcNode[k] = +1;
+          else
+            tNode[k] = core::acosd (cost) / 15.0, rcNode[k] = 0;
+        }
+
+        const double c0 = tNode[1];
+        const double c1 = 0.5 * (tNode[2] - tNode[0]);
+        const double c2 = 0.5 * (tNode[2] + tNode[0]) - tNode[1];
+        const bool mixedStatus = rcNode[0] != rcNode[1] || rcNode[1] != rcNode[2]
+                                 || rcNode[3] != rcNode[1] || rcNode[4] != rcNode[1];
+        const bool poorFit = std::fabs (c0 - 0.5 * c1 + 0.25 * c2 - tNode[3]) > tolerance
+                             || std::fabs (c0 + 0.5 * c1 + 0.25 * c2 - tNode[4]) > tolerance;
+
+        if ((mixedStatus || poorFit) && options_.exactPolarRows) {
+          for (std::size_t j = 0; j < nLon; ++j) {
+            const core::DiurnalArc arc
+                = core::diurnalArc (columns_[j].sinAltit, sinLat, cosLat, columns_[j].transit);
+            store (row + j, tsouth_[j], arc.t, arc.rc, rise_, set_, dayLength_, status_);
+          }
+          continue;
+        }
+
+        // O(nLon) cheap combine, one contiguous pass per output so the loops vectorize
+        const double* xs = x_.data ();
+        const double* xs2 = x2_.data ();
+        const double* ts = tsouth_.data ();
+        double* tr = t.data ();
+        for (std::size_t j = 0; j < nLon; ++j) {
+          // Plain selects instead of std::fmin/fmax, which stay libm calls without -ffast-math
+          const double q = c0 + c1 * xs[j] + c2 * xs2[j];
+          tr[j] = q < 0.0 ? 0.0 : (q > 12.0 ? 12.0 : q);
+        }
+        if (rise_)
+          for (std::size_t j = 0; j < nLon; ++j)
+            rise_[row + j] = ts[j] - tr[j];
+        if (set_)
+          for (std::size_t j = 0; j < nLon; ++j)
+            set_[row + j] = ts[j] + tr[j];
+        if (dayLength_)
+          for (std::size_t j = 0; j < nLon; ++j)
+            dayLength_[row + j] = 2.0 * tr[j];
+        if (status_ && !mixedStatus)
+          std::fill_n (status_ + row, nLon, static_cast<std::int8_t> (rcNode[1]));
+        else if (status_)
+          for (std::size_t j = 0; j < nLon; ++j)
+            status_[row + j]
+                = static_cast<std::int8_t> (rcNode[xs[j] < -0.5 ? 0 : (xs[j] > 0.5 ? 2 : 1)]);
+      }
+    }
+
+  } // namespace grid
+
+  void sunrisetGrid (int year, int month, int day, const GridSpec& grid,
+                     const GridOptions& options, double* rise, double* set, double* dayLength,
+                     std::int8_t* status) {
+    if (grid.nLat == 0 || grid.nLon == 0)
+      return;
+
+    grid::GridPlan plan (year, month, day, grid, options, rise, set, dayLength, status);
+    plan.prepareColumns (0, grid.nLon);
+    plan.fillRows (0, grid.nLat);
+  }
+
+} // namespace dotname
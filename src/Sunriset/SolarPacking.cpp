@@ -0,0 +1,223 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <Logger/Logger.hpp>
+#include <Sunriset/SolarPacking.hpp>
+
+#include <algorithm>
+
+namespace dotname {
+
+  namespace {
+
+    constexpr double kPackedRangeHours = 68.0; // -16:00 to 52:00 UT
+    constexpr std::uint8_t kMixedStatus = 3;
+
+    std::uint32_t zigzag (std::int64_t delta) {
+      return static_cast<std::uint32_t> ((static_cast<std::uint64_t> (delta) << 1)
+                                         ^ static_cast<std::uint64_t> (delta >> 63));
+    }
+    std::int64_t unzigzag (std::uint32_t code) {
+      return static_cast<std::int64_t> (code >> 1) ^ -static_cast<std::int64_t> (code & 1u);
+    }
+
+    unsigned bitWidth (std::uint32_t value) {
+      unsigned width = 0;
+      for (; value != 0; value >>= 1)
+        ++width;
+      return width;
+    }
+
+    class BitWriter {
+    public:
+      explicit BitWriter (std::vector<std::uint64_t>& words) : words_ (words) {}
+
+      std::size_t position () const {
+        return position_;
+      }
+
+      void put (std::uint64_t value, unsigned width) {
+        if (width == 0) {
+          return;
+        }
+        const std::size_t word = position_ >> 6;
+        const unsigned shift = position_ & 63;
+        if (words_.size () < word + 2) {
+          words_.resize (word + 2, 0);
+        }
+        words_[word] |= value << shift;
+        if (shift + width > 64) {
+          words_[word + 1] |= value >> (64 - shift);
+        }
+        position_ += width;
+      }
+
+    private:
+      std::vector<std::uint64_t>& words_;
+      std::size_t position_ = 0;
+    };
+
+    // `words` has a spare word past the last bit written, so the second load is in bounds
+    inline std::uint32_t getBits (const std::uint64_t* words, std::size_t position,
+                                  unsigned width) {
+      const std::size_t word = position >> 6;
+      const unsigned shift = position & 63;
+      const std::uint64_t bits = (words[word] >> shift) | ((words[word + 1] << 1) << (63 - shift));
+      return static_cast<std::uint32_t> (bits & ((std::uint64_t{ 1 } << width) - 1));
+    }
+
+  } // namespace
+
+  void packBatch (const double* start, const double* end, const std::int8_t* status,
+                  std::size_t count, PackedEventTimes* out) {
+    for (std::size_t i = 0; i < count; ++i)
+      out[i] = { packTime (start[i], status[i]), packTime (end[i]) };
+  }
+
+  void unpackBatch (const PackedEventTimes* packed, std::size_t count, double* start,
+                    double* end, std::int8_t* status) {
+    // Branch-free so the loop vectorizes; the status goes through a 4-entry table
+    static constexpr std::int8_t kStatus[4]
+        = { SolarStatus::RisesAndSets, SolarStatus::AlwaysAbove, SolarStatus::AlwaysBelow,
+            SolarStatus::RisesAndSets };
+    for (std::size_t i = 0; i < count; ++i) {
+      const unsigned s = packed[i].start;
+      start[i] = packing::dequantize (s & packing::kMinuteMask, 1.0 / 60.0);
+      end[i] = packing::dequantize (packed[i].end & packing::kMinuteMask, 1.0 / 60.0);
+      status[i] = kStatus[(s >> packing::kMinuteBits) & 3u];
+    }
+  }
+
+  void PackedSeries::clear () {
+    blocks_.clear ();
+    bits_.clear ();
+    count_ = 0;
+  }
+
+  bool PackedSeries::encode (const double* start, const double* end, const std::int8_t* status,
+                             std::size_t count, unsigned resolutionSeconds) {
+    clear ();
+    if (resolutionSeconds < 1 || resolutionSeconds > 3600) {
+      LOG_E_STREAM << "PackedSeries: resolution " << resolutionSeconds
+                   << " s is outside 1-3600 s" << std::endl;
+      return false;
+    }
+    resolution_ = resolutionSeconds;
+    const double quantaPerHour = 3600.0 / resolution_;
+    const auto limit = static_cast<std::uint32_t> (kPackedRangeHours * quantaPerHour);
+
+    std::vector<std::uint32_t> qStart (kBlockDays), qEnd (kBlockDays);
+    std::vector<std::uint32_t> dStart (kBlockDays), dEnd (kBlockDays);
+    BitWriter writer (bits_);
+    blocks_.reserve ((count + kBlockDays - 1) / kBlockDays);
+
+    for (std::size_t first = 0; first < count; first += kBlockDays) {
+      const std::size_t n = std::min (kBlockDays, count - first);
+      std::uint32_t maxStart = 0, maxEnd = 0;
+      const unsigned firstStatus = packing::statusCode (status[first]);
+      bool uniform = true;
+      for (std::size_t i = 0; i < n; ++i) {
+        qStart[i] = packing::quantize (start[first + i], quantaPerHour, limit);
+        qEnd[i] = packing::quantize (end[first + i], quantaPerHour, limit);
+        uniform = uniform && packing::statusCode (status[first + i]) == firstStatus;
+        if (i > 0) {
+          dStart[i] = zigzag (static_cast<std::int64_t> (qStart[i]) - qStart[i - 1]);
+          dEnd[i] = zigzag (static_cast<std::int64_t> (qEnd[i]) - qEnd[i - 1]);
+          maxStart = std::max (maxStart, dStart[i]);
+          maxEnd = std::max (maxEnd, dEnd[i]);
+        }
+      }
+
+      Block block{};
+      block.bitOffset = static_cast<std::uint32_t> (writer.position ());
+      block.firstStart = qStart[0];
+      block.firstEnd = qEnd[0];
+      block.startBits = static_cast<std::uint8_t> (bitWidth (maxStart));
+      block.endBits = static_cast<std::uint8_t> (bitWidth (maxEnd));
+      block.status = uniform ? static_cast<std::uint8_t> (firstStatus) : kMixedStatus;
+      for (std::size_t i = 1; i < n; ++i) {
+        writer.put (dStart[i], block.startBits);
+        writer.put (dEnd[i], block.endBits);
+      }
+      if (!uniform) {
+        for (std::size_t i = 0; i < n; ++i)
+          writer.put (packing::statusCode (status[first + i]), 2);
+      }
+      blocks_.push_back (block);
+    }
+
+    bits_.resize ((writer.position () >> 6) + 2, 0);
+    bits_.shrink_to_fit ();
+    count_ = count;
+    return true;
+  }
+
+  bool PackedSeries::encode (const SolarDay* days, std::size_t count, SolarEvent event,
+                             unsigned resolutionSeconds) {
+    std::vector<double> start (count), end (count);
+    std::vector<std::int8_t> status (count);
+    for (std::size_t i = 0; i < count; ++i) {
+      const SolarEventTimes& times = days[i][event];
+      start[i] = times.start;
+      end[i] = times.end;
+      status[i] = times.status;
+    }
+    return encode (start.data (), end.data (), status.data (), count, resolutionSeconds);
+  }
+
+  void PackedSeries::decodeBlock (std::size_t index, std::size_t from, std::size_t to,
+                                  double* start, double* end, std::int8_t* status) const {
+    const Block& block = blocks_[index];
+    const std::uint64_t* words = bits_.data ();
+    const double hoursPerQuantum = resolution_ / 3600.0;
+    const unsigned startBits = block.startBits;
+    const unsigned endBits = block.endBits;
+
+    std::size_t position = block.bitOffset;
+    std::int64_t qStart = block.firstStart;
+    std::int64_t qEnd = block.firstEnd;
+    for (std::size_t i = 0; i < to; ++i) {
+      if (i > 0) {
+        qStart += unzigzag (getBits (words, position, startBits));
+        qEnd += unzigzag (getBits (words, position + startBits, endBits));
+        position += startBits + endBits;
+      }
+      if (i >= from) {
+        start[i - from] = packing::dequantize (static_cast<std::uint32_t> (qStart),
+                                                 hoursPerQuantum);
+        end[i - from] = packing::dequantize (static_cast<std::uint32_t> (qEnd),
+                                               hoursPerQuantum);
+      }
+    }
+
+    if (block.status != kMixedStatus) {
+      std::fill (status, status + (to - from), packing::statusFromCode (block.status));
+      return;
+    }
+    const std::size_t n = std::min (kBlockDays, count_ - index * kBlockDays);
+    const std::size_t statusBits = block.bitOffset + (n - 1) * (startBits + endBits);
+    for (std::size_t i = from; i < to; ++i)
+      status[i - from] = packing::statusFromCode (getBits (words, statusBits + 2 * i, 2));
+  }
+
+  SolarEventTimes PackedSeries::at (std::size_t index) const {
+    SolarEventTimes times{};
+    decodeBlock (index / kBlockDays, index % kBlockDays, index % kBlockDays + 1, &times.start,
+                 &times.end, &times.status);
+    return times;
+  }
+
+  void PackedSeries::decode (std::size_t first, std::size_t count, double* start, double* end,
+                             std::int8_t* status) const {
+    const std::size_t last = std::min (first + count, count_);
+    for (std::size_t day = first; day < last;) {
+      const std::size_t block = day / kBlockDays;
+      const std::size_t from = day % kBlockDays;
+      const std::size_t to = std::min (kBlockDays, last - block * kBlockDays);
+      const std::size_t done = day - first;
+      decodeBlock (block, from, to, start + done, end + done, status + done);
+      day += to - from;
+    }
+  }
+
+} // namespace dotname
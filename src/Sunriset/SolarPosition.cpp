@@ -0,0 +1,186 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <Sunriset/SolarCore.hpp>
+#include <Sunriset/SolarPosition.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace dotname {
+
+  namespace {
+
+    double sinElevation (const SubsolarPoint& sun, double lat, double lon) {
+      return core::sind (lat) * sun.sinDec
+             + core::cosd (lat) * sun.cosDec * core::cosd (lon - sun.lon);
+    }
+
+    // From sin/cos of the latitude, the declination and the hour angle
+    HorizontalPosition horizontal (double sinLat, double cosLat, double sinDec, double cosDec,
+                                   double sinH, double cosH) {
+      const double sinEl = sinLat * sinDec + cosLat * cosDec * cosH;
+      const double y = -cosDec * sinH;
+      const double x = sinDec * cosLat - cosDec * cosH * sinLat;
+      return { core::kRadeg * std::asin (std::clamp (sinEl, -1.0, 1.0)),
+               core::revolution (core::atan2d (y, x)) };
+    }
+
+    // x (k) = x (0) + first * k + second * k * k through the values at 0, n / 2 and n
+    struct Quadratic {
+      double first;
+      double second;
+    };
+
+    Quadratic quadratic (double atMid, double atEnd, double n) {
+      const double second = 2.0 * (atEnd - 2.0 * atMid) / (n * n);
+      return { atEnd / n - second * n, second };
+    }
+
+    // sin/cos of x (k) by rotation: x steps by first + second * (2k + 1), and the step
+    // itself is rotated by 2 * second each sample
+    struct Rotation {
+      double sinX, cosX;
+      double sinStep, cosStep;
+      double sinDelta, cosDelta;
+
+      Rotation (double sinX0, double cosX0, const Quadratic& q)
+          : sinX (sinX0), cosX (cosX0), sinStep (core::sind (q.first + q.second)),
+            cosStep (core::cosd (q.first + q.second)), sinDelta (core::sind (2.0 * q.second)),
+            cosDelta (core::cosd (2.0 * q.second)) {}
+      Rotation (double x0, const Quadratic& q) : Rotation (core::sind (x0), core::cosd (x0), q) {}
+
+      void advance () {
+        const double nextSin = sinX * cosStep + cosX * sinStep;
+        cosX = cosX * cosStep - sinX * sinStep;
+        sinX = nextSin;
+        const double nextSinStep = sinStep * cosDelta + cosStep * sinDelta;
+        cosStep = cosStep * cosDelta - sinStep * sinDelta;
+        sinStep = nextSinStep;
+      }
+    };
+
+  } // namespace
+
+  SubsolarPoint subsolarPoint (double d) {
+    const core::SunEquatorial sun = core::sunRaDec (d);
+    // GMST0 follows the mean Sun through the day, so the sidereal time at Greenwich is
+    // GMST0 (d) + 15 * UT, as in Schlyter's notes that sunriset.c comes from
+    const double hoursUT = (d - std::floor (d)) * 24.0;
+
+    SubsolarPoint sub;
+    sub.d = d;
+    sub.lat = sun.dec;
+    sub.lon = core::rev180 (sun.ra - core::gmst0 (d) - 15.0 * hoursUT);
+    sub.sinDec = core::sind (sun.dec);
+    sub.cosDec = core::cosd (sun.dec);
+    sub.sradius = 0.2666 / sun.r;
+    return sub;
+  }
+
+  SubsolarPoint subsolarPoint (int year, int month, int day, double hoursUT) {
+    return subsolarPoint (static_cast<double> (core::daysSince2000Jan0 (year, month, day))
+                          + hoursUT / 24.0);
+  }
+
+  double solarElevation (const SubsolarPoint& sun, double lat, double lon) {
+    const double sinH = sinElevation (sun, lat, lon);
+    return core::kRadeg * std::asin (std::fmax (-1.0, std::fmin (1.0, sinH)));
+  }
+
+  HorizontalPosition solarPosition (const SubsolarPoint& sun, double lat, double lon) {
+    const double h = lon - sun.lon; // local hour angle
+    return horizontal (core::sind (lat), core::cosd (lat), sun.sinDec, sun.cosDec,
+                       core::sind (h), core::cosd (h));
+  }
+
+  SolarPositionSeries::SolarPositionSeries (double startD, double stepSeconds,
+                                            std::size_t count, std::size_t anchorInterval)
+      : startD_ (startD), step_ (stepSeconds / 86400.0), count_ (count) {
+    anchorInterval = std::max<std::size_t> (anchorInterval, 1);
+    for (std::size_t k = 0; k < count; k += anchorInterval)
+      anchorSample_.push_back (k);
+    if (count > 0 && anchorSample_.back () != count - 1)
+      anchorSample_.push_back (count - 1);
+    anchors_.reserve (anchorSample_.size ());
+    for (const std::size_t k : anchorSample_)
+      anchors_.push_back (subsolarPoint (instant (k)));
+    midpoints_.reserve (anchors_.size ());
+    for (std::size_t a = 0; a + 1 < anchors_.size (); ++a)
+      midpoints_.push_back (subsolarPoint (0.5 * (anchors_[a].d + anchors_[a + 1].d)));
+  }
+
+  SolarPositionSeries::SolarPositionSeries (int year, int month, int day, double startHoursUT,
+                                            double stepSeconds, std::size_t count,
+                                            std::size_t anchorInterval)
+      : SolarPositionSeries (static_cast<double> (core::daysSince2000Jan0 (year, month, day))
+                                 + startHoursUT / 24.0,
+                             stepSeconds, count, anchorInterval) {}
+
+  void SolarPositionSeries::evaluate (double lat, double lon, double* elevation,
+                                      double* azimuth) const {
+    if (count_ == 0)
+      return;
+    const double sinLat = core::sind (lat);
+    const double cosLat = core::cosd (lat);
+    const auto put = [&] (std::size_t k, const HorizontalPosition& p) {
+      if (elevation)
+        elevation[k] = p.elevation;
+      if (azimuth)
+        azimuth[k] = p.azimuth;
+    };
+
+    for (std::size_t a = 0; a + 1 < anchors_.size (); ++a) {
+      const SubsolarPoint& from = anchors_[a];
+      const SubsolarPoint& mid = midpoints_[a];
+      const SubsolarPoint& to = anchors_[a + 1];
+      const std::size_t first = anchorSample_[a];
+      const auto n = static_cast<double> (anchorSample_[a + 1] - first);
+
+      // The hour angle grows by ~360 degrees a day; the exact advance differs from that
+      // by the RA drift, far less than a half turn
+      const double h0 = lon - from.lon;
+      const double nominal = 360.0 * (to.d - from.d);
+      const double advance = nominal + core::rev180 ((lon - to.lon) - h0 - nominal);
+      const double midAdvance
+          = 0.5 * nominal + core::rev180 ((lon - mid.lon) - h0 - 0.5 * nominal);
+      const Quadratic h = quadratic (midAdvance, advance, n);
+      const Quadratic dec = quadratic (mid.lat - from.lat, to.lat - from.lat, n);
+
+      Rotation hourAngle (h0, h), declination (from.sinDec, from.cosDec, dec);
+      for (std::size_t k = first; k < anchorSample_[a + 1]; ++k) {
+        put (k, horizontal (sinLat, cosLat, declination.sinX, declination.cosX,
+                            hourAngle.sinX, hourAngle.cosX));
+        hourAngle.advance ();
+        declination.advance ();
+      }
+    }
+    put (count_ - 1, solarPosition (anchors_.back (), lat, lon));
+  }
+
+  double illuminationFloor (const SubsolarPoint& sun, Illumination state) {
+    switch (state) {
+    case Illumination::Day:
+      return solarEventParams (SolarEvent::SunriseSunset).altit - sun.sradius;
+    case Illumination::CivilTwilight:
+      return solarEventParams (SolarEvent::CivilTwilight).altit;
+    case Illumination::NauticalTwilight:
+      return solarEventParams (SolarEvent::NauticalTwilight).altit;
+    case Illumination::AstronomicalTwilight:
+      return solarEventParams (SolarEvent::AstronomicalTwilight).altit;
+    case Illumination::Night:
+    default:
+      return -90.0;
+    }
+  }
+
+  Illumination illumination (const SubsolarPoint& sun, double lat, double lon) {
+    const double sinH = sinElevation (sun, lat, lon);
+    for (int state = 0; state < static_cast<int> (Illumination::Night); ++state) {
+      if (sinH > core::sind (illuminationFloor (sun, static_cast<Illumination> (state))))
+        return static_cast<Illumination> (state);
+    }
+    return Illumination::Night;
+  }
+
+} // namespace dotname
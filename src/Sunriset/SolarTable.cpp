@@ -0,0 +1,415 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <Logger/Logger.hpp>
+#include <Sunriset/SolarCore.hpp>
+#include <Sunriset/SolarTable.hpp>
+#include <Utils/Utils.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace dotname {
+
+  namespace {
+
+    constexpr char kMagic[8] = { 'S', 'R', 'T', 'A', 'B', 'L', 'E', '\0' };
+    constexpr std::uint32_t kByteOrderMark = 0x01020304;
+    constexpr std::uint8_t kNoonEvent = 0xff;
+    constexpr std::size_t kAlign = 64;
+
+    struct FileHeader {
+      char magic[8];
+      std::uint32_t version;
+      std::uint32_t byteOrder;
+      std::uint64_t siteCount;
+      std::int64_t firstDay;
+      std::uint32_t dayCount;
+      std::uint8_t eventMask;
+      std::uint8_t reserved[3];
+      std::uint64_t hashOffset;
+      std::uint32_t hashSlots;
+      std::uint32_t columnCount;
+      std::uint64_t sitesOffset;
+      std::uint64_t directoryOffset;
+      std::uint64_t fileSize;
+    };
+
+    struct ColumnEntry {
+      std::uint8_t event;
+      std::uint8_t field;
+      std::uint16_t elementBytes;
+      std::uint32_t reserved;
+      std::uint64_t offset;
+    };
+
+    static_assert (sizeof (SolarTable::Site) == 24, "Site is stored as is");
+    static_assert (sizeof (ColumnEntry) == 16, "ColumnEntry is stored as is");
+
+    constexpr std::uint64_t alignUp (std::uint64_t offset) {
+      return (offset + kAlign - 1) / kAlign * kAlign;
+    }
+
+    // splitmix64 finalizer, ids are often sequential
+    std::uint32_t hashId (std::uint64_t id) {
+      id ^= id >> 30;
+      id *= 0xbf58476d1ce4e5b9ull;
+      id ^= id >> 27;
+      id *= 0x94d049bb133111ebull;
+      id ^= id >> 31;
+      return static_cast<std::uint32_t> (id);
+    }
+
+    std::uint32_t hashSlotsFor (std::size_t siteCount) {
+      std::uint32_t slots = 16;
+      while (slots < 2 * siteCount) {
+        slots <<= 1;
+      }
+      return slots;
+    }
+
+    double valueOf (const SolarDay& d, const ColumnEntry& column) {
+      if (column.event == kNoonEvent) {
+        return d.solarNoon;
+      }
+      const SolarEventTimes& times = d.events[column.event];
+      switch (static_cast<SolarTable::Field> (column.field)) {
+      case SolarTable::Field::Start:
+        return times.start;
+      case SolarTable::Field::End:
+        return times.end;
+      default:
+        break;
+      }
+      switch (static_cast<SolarEvent> (column.event)) {
+      case SolarEvent::CivilTwilight:
+        return d.civilTwilightLength;
+      case SolarEvent::NauticalTwilight:
+        return d.nauticalTwilightLength;
+      case SolarEvent::AstronomicalTwilight:
+        return d.astronomicalTwilightLength;
+      case SolarEvent::SunriseSunset:
+      default:
+        return d.dayLength;
+      }
+    }
+
+  } // namespace
+
+  struct SolarTable::Mapping {
+    Utils::FSManager::MappedFile file;
+  };
+
+  bool SolarTable::generate (const std::filesystem::path& filePath,
+                             const std::vector<Site>& sites, int year, int month, int day,
+                             std::size_t dayCount, std::uint8_t eventMask) {
+    eventMask &= kAllEvents;
+    if (sites.size () >= 0x80000000u || dayCount == 0 || dayCount > 0xffffffffu) {
+      LOG_E_STREAM << "Solar table " << filePath << ": site or day count out of range"
+                   << std::endl;
+      return false;
+    }
+
+    FileHeader header{};
+    std::memcpy (header.magic, kMagic, sizeof (kMagic));
+    header.version = kVersion;
+    header.byteOrder = kByteOrderMark;
+    header.siteCount = sites.size ();
+    header.firstDay = core::daysSince2000Jan0 (year, month, day);
+    header.dayCount = static_cast<std::uint32_t> (dayCount);
+    header.eventMask = eventMask;
+
+    // site hash, rejecting duplicate ids
+    std::vector<std::uint32_t> hash (hashSlotsFor (sites.size ()), 0);
+    const std::uint32_t mask = static_cast<std::uint32_t> (hash.size () - 1);
+    for (std::size_t i = 0; i < sites.size (); ++i) {
+      std::uint32_t slot = hashId (sites[i].id) & mask;
+      for (; hash[slot] != 0; slot = (slot + 1) & mask) {
+        if (sites[hash[slot] - 1].id == sites[i].id) {
+          LOG_E_STREAM << "Solar table " << filePath << ": duplicate site id " << sites[i].id
+                       << std::endl;
+          return false;
+        }
+      }
+      hash[slot] = static_cast<std::uint32_t> (i + 1);
+    }
+
+    // solar noon, then Start, End, Length, Status of every stored event
+    std::vector<ColumnEntry> directory;
+    directory.push_back ({ kNoonEvent, 0, 8, 0, 0 });
+    for (std::uint8_t e = 0; e < 4; ++e) {
+      if ((eventMask >> e) & 1u) {
+        for (Field f : { Field::Start, Field::End, Field::Length, Field::Status }) {
+          const std::uint16_t bytes = f == Field::Status ? 1 : 8;
+          directory.push_back ({ e, static_cast<std::uint8_t> (f), bytes, 0, 0 });
+        }
+      }
+    }
+
+    const std::uint64_t cells = std::uint64_t{ sites.size () } * dayCount;
+    std::uint64_t offset = alignUp (sizeof (FileHeader));
+    header.hashOffset = offset;
+    header.hashSlots = static_cast<std::uint32_t> (hash.size ());
+    offset = alignUp (offset + hash.size () * sizeof (std::uint32_t));
+    header.sitesOffset = offset;
+    offset = alignUp (offset + sites.size () * sizeof (Site));
+    header.directoryOffset = offset;
+    header.columnCount = static_cast<std::uint32_t> (directory.size ());
+    offset = alignUp (offset + directory.size () * sizeof (ColumnEntry));
+    std::uint64_t dataEnd = offset;
+    for (ColumnEntry& column : directory) {
+      column.offset = offset;
+      dataEnd = offset + cells * column.elementBytes;
+      offset = alignUp (dataEnd);
+    }
+    header.fileSize = offset;
+
+    std::ofstream file (filePath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+      LOG_E_STREAM << "Cannot write solar table " << filePath << std::endl;
+      return false;
+    }
+    const auto writeAt = [&file] (std::uint64_t at, const void* data, std::size_t bytes) {
+      file.seekp (static_cast<std::streamoff> (at));
+      file.write (static_cast<const char*> (data), static_cast<std::streamsize> (bytes));
+    };
+    writeAt (0, &header, sizeof (header));
+    writeAt (header.hashOffset, hash.data (), hash.size () * sizeof (std::uint32_t));
+    writeAt (header.sitesOffset, sites.data (), sites.size () * sizeof (Site));
+    writeAt (header.directoryOffset, directory.data (), directory.size () * sizeof (ColumnEntry));
+
+    // one site at a time: its days are contiguous in every column
+    std::vector<SolarDay> days (dayCount);
+    std::vector<double> values (dayCount);
+    std::vector<std::int8_t> statuses (dayCount);
+    for (std::size_t s = 0; s < sites.size () && file; ++s) {
+      solarDayRange (year, month, day, dayCount, sites[s].lon, sites[s].lat, days.data ());
+      for (const ColumnEntry& column : directory) {
+        const std::uint64_t at
+            = column.offset + std::uint64_t{ s } * dayCount * column.elementBytes;
+        if (static_cast<Field> (column.field) == Field::Status) {
+          for (std::size_t d = 0; d < dayCount; ++d) {
+            statuses[d] = days[d].events[column.event].status;
+          }
+          writeAt (at, statuses.data (), dayCount);
+          continue;
+        }
+        for (std::size_t d = 0; d < dayCount; ++d) {
+          values[d] = valueOf (days[d], column);
+        }
+        writeAt (at, values.data (), dayCount * sizeof (double));
+      }
+    }
+    if (dataEnd < header.fileSize) { // the padding after the last column
+      const char zero = 0;
+      writeAt (header.fileSize - 1, &zero, 1);
+    }
+    file.close ();
+    if (!file) {
+      LOG_E_STREAM << "Cannot write solar table " << filePath << std::endl;
+      return false;
+    }
+    return true;
+  }
+
+  SolarTable::SolarTable () = default;
+
+  SolarTable::SolarTable (const std::filesystem::path& filePath) {
+    open (filePath);
+  }
+
+  SolarTable::~SolarTable () = default;
+
+  SolarTable::SolarTable (SolarTable&& other) noexcept {
+    *this = std::move (other);
+  }
+
+  SolarTable& SolarTable::operator= (SolarTable&& other) noexcept {
+    if (this != &other) {
+      mapping_ = std::move (other.mapping_);
+      base_ = other.base_;
+      siteCount_ = other.siteCount_;
+      dayCount_ = other.dayCount_;
+      firstDay_ = other.firstDay_;
+      eventMask_ = other.eventMask_;
+      hash_ = other.hash_;
+      hashMask_ = other.hashMask_;
+      sites_ = other.sites_;
+      noon_ = other.noon_;
+      std::copy (&other.columns_[0][0], &other.columns_[0][0] + 12, &columns_[0][0]);
+      std::copy (other.status_, other.status_ + 4, status_);
+      other.close ();
+    }
+    return *this;
+  }
+
+  void SolarTable::close () {
+    mapping_.reset ();
+    base_ = nullptr;
+    siteCount_ = dayCount_ = 0;
+    firstDay_ = 0;
+    eventMask_ = 0;
+    hash_ = nullptr;
+    hashMask_ = 0;
+    sites_ = nullptr;
+    noon_ = nullptr;
+    std::fill (&columns_[0][0], &columns_[0][0] + 12, nullptr);
+    std::fill (status_, status_ + 4, nullptr);
+  }
+
+  bool SolarTable::open (const std::filesystem::path& filePath) {
+    close ();
+    auto mapping = std::make_unique<Mapping> ();
+    if (!mapping->file.open (filePath, Utils::FSManager::MappedFile::Advice::Random)) {
+      return false;
+    }
+    const char* base = mapping->file.data ();
+    const std::uint64_t size = mapping->file.size ();
+    const auto invalid = [this, &filePath] (const char* what) {
+      close ();
+      LOG_E_STREAM << "Invalid solar table " << filePath << ": " << what << std::endl;
+      return false;
+    };
+    // a section of count elements at offset lies within the file and is aligned
+    const auto fits = [size] (std::uint64_t offset, std::uint64_t count, std::uint64_t bytes) {
+      return offset % kAlign == 0 && offset <= size && count <= (size - offset) / bytes;
+    };
+
+    FileHeader header;
+    if (size < sizeof (header)) {
+      return invalid ("truncated header");
+    }
+    std::memcpy (&header, base, sizeof (header));
+    if (std::memcmp (header.magic, kMagic, sizeof (kMagic)) != 0) {
+      return invalid ("bad magic");
+    }
+    if (header.byteOrder != kByteOrderMark) {
+      return invalid ("written with the other byte order");
+    }
+    if (header.version != kVersion) {
+      return invalid ("unsupported version");
+    }
+    if (header.fileSize != size) {
+      return invalid ("size does not match the header");
+    }
+    const std::uint64_t cells = header.siteCount * header.dayCount;
+    if (header.siteCount >= 0x80000000u || header.dayCount == 0
+        || cells / header.dayCount != header.siteCount
+        || (header.hashSlots & (header.hashSlots - 1)) != 0 || header.hashSlots <= header.siteCount
+        || !fits (header.hashOffset, header.hashSlots, sizeof (std::uint32_t))
+        || !fits (header.sitesOffset, header.siteCount, sizeof (Site))
+        || !fits (header.directoryOffset, header.columnCount, sizeof (ColumnEntry))) {
+      return invalid ("section out of range");
+    }
+
+    const auto* directory = reinterpret_cast<const ColumnEntry*> (base + header.directoryOffset);
+    for (std::uint32_t c = 0; c < header.columnCount; ++c) {
+      const ColumnEntry& column = directory[c];
+      const bool noon = column.event == kNoonEvent;
+      // the noon column is a Start column of doubles
+      const bool status = !noon && static_cast<Field> (column.field) == Field::Status;
+      if ((!noon && column.event >= 4) || column.field > 3
+          || (noon && static_cast<Field> (column.field) != Field::Start)
+          || column.elementBytes != (status ? 1 : 8)
+          || !fits (column.offset, cells, column.elementBytes)) {
+        return invalid ("bad column directory");
+      }
+      const char* data = base + column.offset;
+      if (noon) {
+        if (noon_ != nullptr) {
+          return invalid ("duplicate column");
+        }
+        noon_ = reinterpret_cast<const double*> (data);
+      } else if (status) {
+        if (status_[column.event] != nullptr) {
+          return invalid ("duplicate column");
+        }
+        status_[column.event] = reinterpret_cast<const std::int8_t*> (data);
+      } else {
+        if (columns_[column.event][column.field] != nullptr) {
+          return invalid ("duplicate column");
+        }
+        columns_[column.event][column.field] = reinterpret_cast<const double*> (data);
+      }
+    }
+    for (unsigned e = 0; e < 4; ++e) {
+      if (((header.eventMask >> e) & 1u)
+          && (!columns_[e][0] || !columns_[e][1] || !columns_[e][2] || !status_[e])) {
+        return invalid ("missing column");
+      }
+    }
+
+    mapping_ = std::move (mapping);
+    base_ = base;
+    siteCount_ = static_cast<std::size_t> (header.siteCount);
+    dayCount_ = header.dayCount;
+    firstDay_ = static_cast<long> (header.firstDay);
+    eventMask_ = header.eventMask & kAllEvents;
+    hash_ = reinterpret_cast<const std::uint32_t*> (base + header.hashOffset);
+    hashMask_ = header.hashSlots - 1;
+    sites_ = reinterpret_cast<const Site*> (base + header.sitesOffset);
+    return true;
+  }
+
+  std::size_t SolarTable::findSite (std::uint64_t id) const {
+    if (base_ == nullptr) {
+      return npos;
+    }
+    std::uint32_t slot = hashId (id) & hashMask_;
+    for (std::uint32_t probes = 0; probes <= hashMask_; ++probes, slot = (slot + 1) & hashMask_) {
+      const std::uint32_t entry = hash_[slot];
+      if (entry == 0 || entry > siteCount_) {
+        return npos;
+      }
+      if (sites_[entry - 1].id == id) {
+        return entry - 1;
+      }
+    }
+    return npos;
+  }
+
+  // The columns step with core::nextDay, which skips the day number of the phantom
+  // 1900-02-29; a table starting before it is one day shorter past it
+  std::size_t SolarTable::dayIndex (int year, int month, int day) const {
+    const long days = core::daysSince2000Jan0 (year, month, day);
+    long index = days - firstDay_;
+    if (firstDay_ <= core::kDays1900Feb28 && days > core::kDays1900Feb28) {
+      if (days == core::kDays1900Feb28 + 1) {
+        return npos;
+      }
+      --index;
+    }
+    return index >= 0 && static_cast<std::size_t> (index) < dayCount_
+               ? static_cast<std::size_t> (index)
+               : npos;
+  }
+
+  const double* SolarTable::column (SolarEvent event, Field field) const {
+    return field == Field::Status ? nullptr
+                                  : columns_[static_cast<std::size_t> (event)]
+                                            [static_cast<std::size_t> (field)];
+  }
+
+  const std::int8_t* SolarTable::statusColumn (SolarEvent event) const {
+    return status_[static_cast<std::size_t> (event)];
+  }
+
+  SolarEventTimes SolarTable::at (std::size_t site, std::size_t day, SolarEvent event) const {
+    const std::size_t e = static_cast<std::size_t> (event);
+    const std::size_t cell = site * dayCount_ + day;
+    return { columns_[e][0][cell], columns_[e][1][cell], status_[e][cell] };
+  }
+
+  bool SolarTable::lookup (std::uint64_t siteId, int year, int month, int day, SolarEvent event,
+                           SolarEventTimes& out) const {
+    const std::size_t site = findSite (siteId);
+    const std::size_t d = dayIndex (year, month, day);
+    if (site == npos || d == npos || !hasEvent (event)) {
+      return false;
+    }
+    out = at (site, d, event);
+    return true;
+  }
+
+} // namespace dotname
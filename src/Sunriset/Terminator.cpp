@@ -0,0 +1,166 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include <Logger/Logger.hpp>
+#include <Sunriset/SolarCore.hpp>
+#include <Sunriset/Terminator.hpp>
+
+#include "Sunriset/Simd/ElevationKernel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace dotname {
+
+  namespace {
+
+    constexpr double kDefaultBand = 1.0;
+    // Bands closer than this to a class boundary are evaluated site by site, so the
+    // shortcut never decides differently from the per-site comparison
+    constexpr double kBandMargin = 1e-6;
+
+    // Distance from x to the interval [lo, hi], 0 inside it
+    double distance (double x, double lo, double hi) {
+      return std::max ({ 0.0, lo - x, x - hi });
+    }
+
+  } // namespace
+
+  TerminatorIndex::TerminatorIndex (double bandDegrees) : bandDegrees_ (bandDegrees) {
+    if (!(bandDegrees_ > 0.0 && bandDegrees_ <= 180.0)) {
+      LOG_E_STREAM << "TerminatorIndex: band of " << bandDegrees_ << " degrees, using "
+                   << kDefaultBand << std::endl;
+      bandDegrees_ = kDefaultBand;
+    }
+    bandBegin_.assign (1, 0);
+  }
+
+  void TerminatorIndex::build (const LocationSet& sites) {
+    const auto bands = static_cast<std::size_t> (std::ceil (180.0 / bandDegrees_));
+    const auto bandOf = [&] (double lat) {
+      const double b = std::floor ((lat + 90.0) / bandDegrees_);
+      return b <= 0.0 ? std::size_t{ 0 }
+                      : std::min (static_cast<std::size_t> (b), bands - 1);
+    };
+
+    // Counting sort of the live slots by band
+    bandBegin_.assign (bands + 1, 0);
+    for (std::size_t s = 0; s < sites.size (); ++s) {
+      if (sites.isLive (s))
+        ++bandBegin_[bandOf (sites.lat ()[s]) + 1];
+    }
+    largestBand_ = 0;
+    for (std::size_t b = 0; b < bands; ++b) {
+      largestBand_ = std::max (largestBand_, bandBegin_[b + 1]);
+      bandBegin_[b + 1] += bandBegin_[b];
+    }
+
+    const std::size_t count = bandBegin_[bands];
+    slot_.resize (count);
+    id_.resize (count);
+    lon_.resize (count);
+    sinLat_.resize (count);
+    cosLat_.resize (count);
+    bandLatMin_.assign (bands, std::numeric_limits<double>::infinity ());
+    bandLatMax_.assign (bands, -std::numeric_limits<double>::infinity ());
+    std::vector<std::size_t> next (bandBegin_.begin (), bandBegin_.end () - 1);
+    for (std::size_t s = 0; s < sites.size (); ++s) {
+      if (!sites.isLive (s))
+        continue;
+      const double lat = sites.lat ()[s];
+      const std::size_t b = bandOf (lat);
+      const std::size_t k = next[b]++;
+      slot_[k] = s;
+      id_[k] = sites.ids ()[s];
+      lon_[k] = sites.lon ()[s];
+      sinLat_[k] = sites.sinLat ()[s];
+      cosLat_[k] = sites.cosLat ()[s];
+      bandLatMin_[b] = std::min (bandLatMin_[b], lat);
+      bandLatMax_[b] = std::max (bandLatMax_[b], lat);
+    }
+    slotCount_ = sites.size ();
+  }
+
+  template <class Emit>
+  TerminatorIndex::QueryStats TerminatorIndex::select (const SubsolarPoint& sun,
+                                                       Illumination state, SimdLevel level,
+                                                       Emit emit) const {
+    // The class is the elevation interval (floor, ceiling]
+    const bool hasCeiling = state != Illumination::Day;
+    const bool hasFloor = state != Illumination::Night;
+    const double floor = illuminationFloor (sun, state);
+    const double ceiling = hasCeiling
+                               ? illuminationFloor (
+                                     sun, static_cast<Illumination> (static_cast<int> (state) - 1))
+                               : 90.0;
+    const double sinFloor = hasFloor ? core::sind (floor) : -2.0;
+    const double sinCeiling = hasCeiling ? core::sind (ceiling) : 2.0;
+
+    QueryStats stats{};
+    std::vector<double> sinElevation (largestBand_);
+    for (std::size_t b = 0; b + 1 < bandBegin_.size (); ++b) {
+      const std::size_t begin = bandBegin_[b];
+      const std::size_t end = bandBegin_[b + 1];
+      if (begin == end)
+        continue;
+
+      // Over all longitudes, latitude lat sees the Sun between |lat + dec| - 90 and
+      // 90 - |lat - dec|
+      const double highest = 90.0 - distance (sun.lat, bandLatMin_[b], bandLatMax_[b]);
+      const double lowest = distance (-sun.lat, bandLatMin_[b], bandLatMax_[b]) - 90.0;
+      const bool aboveFloor = !hasFloor || lowest > floor + kBandMargin;
+      const bool belowCeiling = !hasCeiling || highest < ceiling - kBandMargin;
+      if (aboveFloor && belowCeiling) {
+        for (std::size_t k = begin; k < end; ++k)
+          emit (k);
+        stats.matches += end - begin;
+        ++stats.bandsTaken;
+        continue;
+      }
+      if ((hasFloor && highest < floor - kBandMargin)
+          || (hasCeiling && lowest > ceiling + kBandMargin)) {
+        ++stats.bandsSkipped;
+        continue;
+      }
+
+      const simd::ElevationKernelArgs args{ lon_.data () + begin, sinLat_.data () + begin,
+                                            cosLat_.data () + begin, sun.lon, sun.sinDec,
+                                            sun.cosDec, sinElevation.data (), end - begin };
+      if (!simd::runElevationKernel (level, args)) {
+        for (std::size_t k = begin; k < end; ++k)
+          sinElevation[k - begin] = sinLat_[k] * sun.sinDec
+                                    + cosLat_[k] * sun.cosDec * core::cosd (lon_[k] - sun.lon);
+      }
+      for (std::size_t k = begin; k < end; ++k) {
+        const double s = sinElevation[k - begin];
+        if (s > sinFloor && s <= sinCeiling) {
+          emit (k);
+          ++stats.matches;
+        }
+      }
+      ++stats.bandsEvaluated;
+      stats.sitesEvaluated += end - begin;
+    }
+    return stats;
+  }
+
+  TerminatorIndex::QueryStats TerminatorIndex::selectBitmap (const SubsolarPoint& sun,
+                                                             Illumination state,
+                                                             std::vector<std::uint64_t>& bitmap,
+                                                             SimdLevel level) const {
+    bitmap.assign ((slotCount_ + 63) / 64, 0);
+    return select (sun, state, level, [&] (std::size_t k) {
+      bitmap[slot_[k] >> 6] |= std::uint64_t{ 1 } << (slot_[k] & 63);
+    });
+  }
+
+  TerminatorIndex::QueryStats TerminatorIndex::selectIds (const SubsolarPoint& sun,
+                                                          Illumination state,
+                                                          std::vector<std::uint64_t>& ids,
+                                                          SimdLevel level) const {
+    ids.clear ();
+    return select (sun, state, level, [&] (std::size_t k) { ids.push_back (id_[k]); });
+  }
+
+} // namespace dotname
@@ -6,12 +6,16 @@
 
 #include "Logger/Logger.hpp"
 
+#include <algorithm>
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <memory>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 // fullfilled from ../cmake/tmplt-assets.cmake)
@@ -31,10 +35,17 @@
 #ifdef _WIN32
   #include <windows.h>
 #elif defined(__APPLE__)
+  #include <fcntl.h>
   #include <limits.h>
   #include <mach-o/dyld.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
 #else // Linux
+  #include <fcntl.h>
   #include <limits.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
   #include <unistd.h>
 #endif
 
@@ -60,6 +71,220 @@ namespace Utils {
       return read (filePath.string ());
     }
 
+    // Read-only memory-mapped view of a whole file, the zero-copy alternative to read ().
+    // Pages are faulted in on first touch and shared with the page cache, so a
+    // multi-gigabyte input costs address space, not heap. Failures are logged and leave
+    // the view closed and empty, as read () does.
+    class MappedFile {
+    public:
+      // Access pattern hints (madvise). DontNeed drops a consumed range from the
+      // resident set; the data stays readable and is faulted back in from the file.
+      enum class Advice { Normal, Sequential, Random, WillNeed, DontNeed };
+
+      MappedFile () = default;
+      explicit MappedFile (const std::filesystem::path& filePath,
+                           Advice advice = Advice::Sequential) {
+        open (filePath, advice);
+      }
+      ~MappedFile () {
+        close ();
+      }
+
+      MappedFile (const MappedFile&) = delete;
+      MappedFile& operator= (const MappedFile&) = delete;
+      MappedFile (MappedFile&& other) noexcept {
+        swap (other);
+      }
+      MappedFile& operator= (MappedFile&& other) noexcept {
+        if (this != &other) {
+          close ();
+          swap (other);
+        }
+        return *this;
+      }
+
+      bool open (const std::filesystem::path& filePath, Advice advice = Advice::Sequential) {
+        close ();
+#ifdef _WIN32
+        const DWORD flags = advice == Advice::Sequential ? FILE_FLAG_SEQUENTIAL_SCAN
+                            : advice == Advice::Random   ? FILE_FLAG_RANDOM_ACCESS
+                                                         : FILE_ATTRIBUTE_NORMAL;
+        file_ = CreateFileW (filePath.c_str (), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                             OPEN_EXISTING, flags, nullptr);
+        LARGE_INTEGER fileSize;
+        if (file_ == INVALID_HANDLE_VALUE || !GetFileSizeEx (file_, &fileSize)) {
+          return fail (filePath, "cannot open");
+        }
+        const unsigned long long bytes = static_cast<unsigned long long> (fileSize.QuadPart);
+#else
+        const int fd = ::open (filePath.c_str (), O_RDONLY | O_CLOEXEC);
+        struct stat info;
+        if (fd < 0 || ::fstat (fd, &info) != 0) {
+          if (fd >= 0) {
+            ::close (fd);
+          }
+          return fail (filePath, "cannot open");
+        }
+        const unsigned long long bytes = static_cast<unsigned long long> (info.st_size);
+#endif
+        if (bytes > static_cast<unsigned long long> (SIZE_MAX)) {
+#ifndef _WIN32
+          ::close (fd);
+#endif
+          return fail (filePath, "too large for the address space");
+        }
+        size_ = static_cast<std::size_t> (bytes);
+        open_ = true;
+        if (size_ == 0) {
+#ifndef _WIN32
+          ::close (fd);
+#endif
+          return true; // nothing to map, an empty view
+        }
+#ifdef _WIN32
+        mapping_ = CreateFileMappingW (file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        void* view = mapping_ ? MapViewOfFile (mapping_, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (view == nullptr) {
+          return fail (filePath, "cannot map");
+        }
+#else
+        void* view = ::mmap (nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close (fd); // the mapping keeps its own reference to the file
+        if (view == MAP_FAILED) {
+          return fail (filePath, "cannot map");
+        }
+#endif
+        data_ = static_cast<const char*> (view);
+        advise (advice);
+        return true;
+      }
+
+      void close () {
+        if (data_ != nullptr) {
+#ifdef _WIN32
+          UnmapViewOfFile (data_);
+#else
+          ::munmap (const_cast<char*> (data_), size_);
+#endif
+        }
+#ifdef _WIN32
+        if (mapping_ != nullptr) {
+          CloseHandle (mapping_);
+        }
+        if (file_ != INVALID_HANDLE_VALUE) {
+          CloseHandle (file_);
+        }
+        mapping_ = nullptr;
+        file_ = INVALID_HANDLE_VALUE;
+#endif
+        data_ = nullptr;
+        size_ = 0;
+        open_ = false;
+      }
+
+      bool isOpen () const {
+        return open_;
+      }
+      explicit operator bool () const {
+        return open_;
+      }
+
+      const char* data () const {
+        return data_;
+      }
+      std::size_t size () const {
+        return size_;
+      }
+      bool empty () const {
+        return size_ == 0;
+      }
+      const char* begin () const {
+        return data_;
+      }
+      const char* end () const {
+        return data_ + size_;
+      }
+
+      std::string_view view () const {
+        return std::string_view (data_, size_);
+      }
+      // clamped to the end of the file
+      std::string_view view (std::size_t offset, std::size_t length) const {
+        if (offset >= size_) {
+          return {};
+        }
+        return std::string_view (data_ + offset, std::min (length, size_ - offset));
+      }
+
+      void advise (Advice advice) const {
+        advise (advice, 0, size_);
+      }
+
+      // The range is widened to whole pages
+      void advise (Advice advice, std::size_t offset, std::size_t length) const {
+        if (data_ == nullptr || offset >= size_) {
+          return;
+        }
+        length = std::min (length, size_ - offset);
+#ifdef _WIN32
+  #if defined(_WIN32_WINNT) && _WIN32_WINNT >= 0x0602
+        if (advice == Advice::WillNeed) {
+          WIN32_MEMORY_RANGE_ENTRY range{ const_cast<char*> (data_ + offset), length };
+          PrefetchVirtualMemory (GetCurrentProcess (), 1, &range, 0);
+        }
+  #endif
+        (void)advice; // the other hints were given to CreateFileW
+#else
+        static const std::size_t page = static_cast<std::size_t> (::sysconf (_SC_PAGESIZE));
+        const std::size_t first = offset / page * page;
+        int hint = MADV_NORMAL;
+        switch (advice) {
+        case Advice::Normal:
+          hint = MADV_NORMAL;
+          break;
+        case Advice::Sequential:
+          hint = MADV_SEQUENTIAL;
+          break;
+        case Advice::Random:
+          hint = MADV_RANDOM;
+          break;
+        case Advice::WillNeed:
+          hint = MADV_WILLNEED;
+          break;
+        case Advice::DontNeed:
+          hint = MADV_DONTNEED;
+          break;
+        }
+        ::madvise (const_cast<char*> (data_) + first, offset + length - first, hint);
+#endif
+      }
+
+    private:
+      bool fail (const std::filesystem::path& filePath, const char* what) {
+        LOG_E_STREAM << "MappedFile " << filePath << ": " << what << std::endl;
+        close ();
+        return false;
+      }
+
+      void swap (MappedFile& other) noexcept {
+        std::swap (data_, other.data_);
+        std::swap (size_, other.size_);
+        std::swap (open_, other.open_);
+#ifdef _WIN32
+        std::swap (file_, other.file_);
+        std::swap (mapping_, other.mapping_);
+#endif
+      }
+
+      const char* data_ = nullptr;
+      std::size_t size_ = 0;
+      bool open_ = false;
+#ifdef _WIN32
+      HANDLE file_ = INVALID_HANDLE_VALUE;
+      HANDLE mapping_ = nullptr;
+#endif
+    };
+
     inline std::string getExecutePath () {
       std::string path;
 #ifdef _WIN32
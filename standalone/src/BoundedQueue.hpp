@@ -0,0 +1,85 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __BOUNDEDQUEUE_HPP
+#define __BOUNDEDQUEUE_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+// Fixed-capacity blocking FIFO connecting two pipeline stages. Both ends report how long
+// they were blocked, which is what the stall statistics of the bulk pipeline are made of.
+template <typename T> class BoundedQueue {
+public:
+  explicit BoundedQueue (std::size_t capacity) : ring_ (capacity > 0 ? capacity : 1) {}
+
+  BoundedQueue (const BoundedQueue&) = delete;
+  BoundedQueue& operator= (const BoundedQueue&) = delete;
+
+  // Blocks while full; false once the queue is closed
+  bool push (T value, std::chrono::nanoseconds& stalled) {
+    std::unique_lock<std::mutex> lock (mutex_);
+    if (size_ == ring_.size () && !closed_) {
+      const auto started = std::chrono::steady_clock::now ();
+      notFull_.wait (lock, [this] { return size_ < ring_.size () || closed_; });
+      stalled += std::chrono::steady_clock::now () - started;
+    }
+    if (closed_) {
+      return false;
+    }
+    ring_[(head_ + size_) % ring_.size ()] = std::move (value);
+    ++size_;
+    lock.unlock ();
+    notEmpty_.notify_one ();
+    return true;
+  }
+
+  bool push (T value) {
+    std::chrono::nanoseconds ignored{ 0 };
+    return push (std::move (value), ignored);
+  }
+
+  // Blocks while empty; false once the queue is closed and drained
+  bool pop (T& value, std::chrono::nanoseconds& stalled) {
+    std::unique_lock<std::mutex> lock (mutex_);
+    if (size_ == 0 && !closed_) {
+      const auto started = std::chrono::steady_clock::now ();
+      notEmpty_.wait (lock, [this] { return size_ != 0 || closed_; });
+      stalled += std::chrono::steady_clock::now () - started;
+    }
+    if (size_ == 0) {
+      return false;
+    }
+    value = std::move (ring_[head_]);
+    head_ = (head_ + 1) % ring_.size ();
+    --size_;
+    lock.unlock ();
+    notFull_.notify_one ();
+    return true;
+  }
+
+  // Wakes every waiter; values already queued can still be popped
+  void close () {
+    {
+      std::lock_guard<std::mutex> lock (mutex_);
+      closed_ = true;
+    }
+    notEmpty_.notify_all ();
+    notFull_.notify_all ();
+  }
+
+private:
+  std::mutex mutex_;
+  std::condition_variable notEmpty_;
+  std::condition_variable notFull_;
+  std::vector<T> ring_;
+  std::size_t head_ = 0;
+  std::size_t size_ = 0;
+  bool closed_ = false;
+};
+
+#endif // __BOUNDEDQUEUE_HPP
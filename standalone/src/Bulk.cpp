@@ -0,0 +1,694 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#include "Bulk.hpp"
+#include "BoundedQueue.hpp"
+
+#include "Logger/Logger.hpp"
+#include "Utils/Utils.hpp"
+#include "Sunriset/Batch.hpp"
+#include "Sunriset/Sunriset.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+  #include <fcntl.h>
+  #include <io.h>
+#endif
+
+namespace Bulk {
+
+  namespace {
+
+    using Utils::FSManager::MappedFile;
+
+    // Hands out the input as runs of at most maxRecords whole records. Regular files are
+    // mapped and sliced without a copy; stdin and pipes go through a buffer that carries
+    // the partial last record over, and a chunk is then only valid until the next call.
+    class ChunkReader {
+    public:
+      ChunkReader (const std::string& path, Format format, std::size_t maxRecords,
+                   std::size_t bufferBytes)
+          : recordBytes_ (format == Format::Binary ? kBinaryInputBytes : 0),
+            maxRecords_ (std::max<std::size_t> (maxRecords, 1)) {
+        if (path == "-") {
+          file_ = stdin;
+#ifdef _WIN32
+          _setmode (_fileno (stdin), _O_BINARY);
+#endif
+        } else if (std::error_code ec; std::filesystem::is_regular_file (path, ec)) {
+          mapped_.open (path, MappedFile::Advice::Sequential);
+        } else {
+          file_ = std::fopen (path.c_str (), "rb");
+          ownsFile_ = file_ != nullptr;
+        }
+        if (file_ != nullptr) {
+          buffer_.resize (std::max<std::size_t> (bufferBytes, 4096));
+        }
+      }
+
+      ~ChunkReader () {
+        if (ownsFile_) {
+          std::fclose (file_);
+        }
+      }
+
+      ChunkReader (const ChunkReader&) = delete;
+      ChunkReader& operator= (const ChunkReader&) = delete;
+
+      bool isOpen () const {
+        return mapped_.isOpen () || file_ != nullptr;
+      }
+
+      // Chunks point into the mapping and stay valid for the lifetime of the reader
+      bool isMapped () const {
+        return mapped_.isOpen ();
+      }
+
+      bool failed () const {
+        return file_ != nullptr && std::ferror (file_) != 0;
+      }
+
+      // Bytes after the last whole binary record, known once next () returned empty
+      std::size_t trailingBytes () const {
+        return trailing_;
+      }
+
+      // Empty at the end of the input
+      std::string_view next () {
+        return mapped_.isOpen () ? nextMapped () : nextStream ();
+      }
+
+      // Any thread: a processed chunk of the mapping leaves the resident set
+      void release (std::string_view chunk) const {
+        if (mapped_.isOpen () && !chunk.empty ()) {
+          mapped_.advise (MappedFile::Advice::DontNeed,
+                          static_cast<std::size_t> (chunk.data () - mapped_.data ()),
+                          chunk.size ());
+        }
+      }
+
+    private:
+      // End of the last whole record in data within maxRecords_, 0 when there is none
+      std::size_t boundary (std::string_view data) const {
+        if (recordBytes_ != 0) {
+          return std::min (data.size () / recordBytes_, maxRecords_) * recordBytes_;
+        }
+        std::size_t end = 0;
+        for (std::size_t lines = 0; lines < maxRecords_; ++lines) {
+          const void* newline = std::memchr (data.data () + end, '\n', data.size () - end);
+          if (newline == nullptr) {
+            break;
+          }
+          end = static_cast<std::size_t> (static_cast<const char*> (newline) - data.data ()) + 1;
+        }
+        return end;
+      }
+
+      // Whatever is left at the end of the input; binary input drops a partial record
+      std::size_t finalEnd (std::size_t size) {
+        trailing_ = recordBytes_ != 0 ? size % recordBytes_ : 0;
+        return size - trailing_;
+      }
+
+      std::string_view nextMapped () {
+        const std::string_view rest = mapped_.view (offset_, mapped_.size ());
+        std::size_t end = boundary (rest);
+        if (end == 0) {
+          end = finalEnd (rest.size ());
+          offset_ = mapped_.size ();
+        } else {
+          offset_ += end;
+        }
+        return rest.substr (0, end);
+      }
+
+      std::string_view nextStream () {
+        for (;;) {
+          const std::string_view data (buffer_.data () + consumed_, filled_ - consumed_);
+          const std::size_t end = boundary (data);
+          if (end != 0) {
+            consumed_ += end;
+            return data.substr (0, end);
+          }
+          if (eof_) {
+            consumed_ = filled_;
+            return data.substr (0, finalEnd (data.size ()));
+          }
+          // only a partial record is left: move it to the front and read behind it
+          std::memmove (buffer_.data (), data.data (), data.size ());
+          filled_ = data.size ();
+          consumed_ = 0;
+          if (filled_ == buffer_.size ()) {
+            buffer_.resize (buffer_.size () * 2); // a line longer than the buffer
+          }
+          const std::size_t want = buffer_.size () - filled_;
+          const std::size_t got = std::fread (buffer_.data () + filled_, 1, want, file_);
+          filled_ += got;
+          eof_ = got < want;
+        }
+      }
+
+      const std::size_t recordBytes_; // 0 for newline-separated text
+      const std::size_t maxRecords_;
+      std::size_t trailing_ = 0;
+
+      MappedFile mapped_;
+      std::size_t offset_ = 0;
+
+      std::FILE* file_ = nullptr;
+      bool ownsFile_ = false;
+      bool eof_ = false;
+      std::vector<char> buffer_;
+      std::size_t filled_ = 0;
+      std::size_t consumed_ = 0;
+    };
+
+    // Collects output in one large buffer and writes it with a single fwrite when full
+    class BufferedWriter {
+    public:
+      BufferedWriter (const std::string& path, std::size_t bytes)
+          : buffer_ (std::max<std::size_t> (bytes, 4096)) {
+        if (path == "-") {
+          file_ = stdout;
+#ifdef _WIN32
+          _setmode (_fileno (stdout), _O_BINARY);
+#endif
+        } else {
+          file_ = std::fopen (path.c_str (), "wb");
+          ownsFile_ = file_ != nullptr;
+        }
+      }
+
+      ~BufferedWriter () {
+        close ();
+      }
+
+      BufferedWriter (const BufferedWriter&) = delete;
+      BufferedWriter& operator= (const BufferedWriter&) = delete;
+
+      bool isOpen () const {
+        return file_ != nullptr;
+      }
+
+      // Small pieces are gathered, one larger than the buffer goes out directly
+      void write (std::string_view text) {
+        if (used_ + text.size () > buffer_.size ()) {
+          flush ();
+        }
+        if (text.size () > buffer_.size ()) {
+          if (file_ != nullptr
+              && std::fwrite (text.data (), 1, text.size (), file_) != text.size ()) {
+            failed_ = true;
+          }
+          return;
+        }
+        std::memcpy (buffer_.data () + used_, text.data (), text.size ());
+        used_ += text.size ();
+      }
+
+      // False once any write failed
+      bool flush () {
+        if (used_ != 0 && file_ != nullptr
+            && std::fwrite (buffer_.data (), 1, used_, file_) != used_) {
+          failed_ = true;
+        }
+        used_ = 0;
+        return !failed_;
+      }
+
+      bool close () {
+        flush ();
+        if (file_ != nullptr && (ownsFile_ ? std::fclose (file_) : std::fflush (file_)) != 0) {
+          failed_ = true;
+        }
+        file_ = nullptr;
+        return !failed_;
+      }
+
+    private:
+      std::vector<char> buffer_;
+      std::size_t used_ = 0;
+      std::FILE* file_ = nullptr;
+      bool ownsFile_ = false;
+      bool failed_ = false;
+    };
+
+    struct Date {
+      int year;
+      int month;
+      int day;
+
+      bool operator== (const Date& other) const {
+        return year == other.year && month == other.month && day == other.day;
+      }
+    };
+
+    // The range days_since_2000_Jan_0 is exact for
+    constexpr int kFirstYear = 1801;
+    constexpr int kLastYear = 2099;
+
+    int daysInMonth (int year, int month) {
+      static constexpr int days[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+      const bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+      return month == 2 && leap ? 29 : days[month - 1];
+    }
+
+    bool validRecord (const Date& date, double lat, double lon) {
+      return date.year >= kFirstYear && date.year <= kLastYear && date.month >= 1
+             && date.month <= 12 && date.day >= 1
+             && date.day <= daysInMonth (date.year, date.month) && std::abs (lat) <= 90.0
+             && std::isfinite (lon);
+    }
+
+    // Structure-of-arrays batch, one per worker, allocated once and refilled
+    struct Batch {
+      explicit Batch (std::size_t capacity)
+          : date (capacity), lat (capacity), lon (capacity), rise (capacity), set (capacity),
+            status (capacity) {}
+
+      // Runs of one date go through the vectorized kernel together
+      void compute () {
+        for (std::size_t i = 0; i < size;) {
+          std::size_t j = i + 1;
+          while (j < size && date[j] == date[i]) {
+            ++j;
+          }
+          dotname::sunrisetBatchVectorized (date[i].year, date[i].month, date[i].day, &lon[i],
+                                            &lat[i], j - i, &rise[i], &set[i], &status[i]);
+          i = j;
+        }
+      }
+
+      std::vector<Date> date;
+      std::vector<double> lat, lon, rise, set;
+      std::vector<std::int8_t> status;
+      std::size_t size = 0;
+    };
+
+    // The parsers advance p past what they read and never allocate
+
+    bool skip (const char*& p, const char* end, char c) {
+      if (p == end || *p != c) {
+        return false;
+      }
+      ++p;
+      return true;
+    }
+
+    void skipSpaces (const char*& p, const char* end) {
+      while (p != end && (*p == ' ' || *p == '\t')) {
+        ++p;
+      }
+    }
+
+    bool parseInt (const char*& p, const char* end, int& value) {
+      const auto [ptr, ec] = std::from_chars (p, end, value);
+      p = ptr;
+      return ec == std::errc ();
+    }
+
+    bool parseDouble (const char*& p, const char* end, double& value) {
+      if (p != end && *p == '+') {
+        ++p;
+      }
+#if defined(__cpp_lib_to_chars)
+      const auto [ptr, ec] = std::from_chars (p, end, value);
+      p = ptr;
+      return ec == std::errc ();
+#else
+      // no floating-point from_chars in this standard library
+      char text[64];
+      const std::size_t n = std::min<std::size_t> (static_cast<std::size_t> (end - p), 63);
+      std::memcpy (text, p, n);
+      text[n] = '\0';
+      char* stop = nullptr;
+      value = std::strtod (text, &stop);
+      p += stop - text;
+      return stop != text;
+#endif
+    }
+
+    // YYYY-MM-DD,lat,lon with optional blanks around the numbers
+    bool parseCsv (std::string_view line, Date& date, double& lat, double& lon) {
+      const char* p = line.data ();
+      const char* end = p + line.size ();
+      bool ok = parseInt (p, end, date.year) && skip (p, end, '-')
+                && parseInt (p, end, date.month) && skip (p, end, '-')
+                && parseInt (p, end, date.day) && skip (p, end, ',');
+      skipSpaces (p, end);
+      ok = ok && parseDouble (p, end, lat);
+      skipSpaces (p, end);
+      ok = ok && skip (p, end, ',');
+      skipSpaces (p, end);
+      ok = ok && parseDouble (p, end, lon);
+      skipSpaces (p, end);
+      return ok && p == end;
+    }
+
+    void decodeBinary (const char* p, Date& date, double& lat, double& lon) {
+      std::int16_t year;
+      std::memcpy (&year, p, sizeof year);
+      date = { year, static_cast<std::uint8_t> (p[2]), static_cast<std::uint8_t> (p[3]) };
+      std::memcpy (&lat, p + 4, sizeof lat);
+      std::memcpy (&lon, p + 12, sizeof lon);
+    }
+
+    // Fixed 6 decimals without printf; hours UT stay within a few dozen
+    char* putHours (char* out, double hours) {
+      if (!std::isfinite (hours)) {
+        std::memcpy (out, "nan", 3);
+        return out + 3;
+      }
+      long long micro = std::llround (hours * 1e6);
+      if (micro < 0) {
+        *out++ = '-';
+        micro = -micro;
+      }
+      out = std::to_chars (out, out + 20, micro / 1000000).ptr;
+      *out++ = '.';
+      long long fraction = micro % 1000000;
+      for (int i = 5; i >= 0; --i, fraction /= 10) {
+        out[i] = static_cast<char> ('0' + fraction % 10);
+      }
+      return out + 6;
+    }
+
+    // Unit of work handed between the pipeline stages. A fixed pool of them circulates
+    // reader -> workers -> writer -> reader, so the buffers are allocated once.
+    struct Chunk {
+      std::size_t index = 0;
+      std::string_view input;
+      std::vector<char> inputCopy; // backs input unless it points into the mapping
+      std::vector<char> output;
+      std::size_t outputSize = 0;
+      std::size_t lines = 0;   // input lines (csv) or records (binary) in the chunk
+      std::size_t records = 0; // results in output
+      std::size_t errorAt = 0; // 1-based line or record that failed to parse, 0 if none
+      bool malformed = false;  // errorAt is not YYYY-MM-DD,lat,lon at all, not a bad value
+    };
+
+    void appendResults (const Batch& batch, Format format, Chunk& chunk) {
+      constexpr std::size_t kMaxRowBytes = 64;
+      if (chunk.output.size () < chunk.outputSize + batch.size * kMaxRowBytes) {
+        chunk.output.resize (chunk.outputSize + batch.size * kMaxRowBytes);
+      }
+      char* out = chunk.output.data () + chunk.outputSize;
+      for (std::size_t i = 0; i < batch.size; ++i) {
+        if (format == Format::Binary) {
+          std::memcpy (out, &batch.rise[i], 8);
+          std::memcpy (out + 8, &batch.set[i], 8);
+          out[16] = static_cast<char> (batch.status[i]);
+          out += kBinaryOutputBytes;
+        } else {
+          out = putHours (out, batch.rise[i]);
+          *out++ = ',';
+          out = putHours (out, batch.set[i]);
+          *out++ = ',';
+          out = std::to_chars (out, out + 4, static_cast<int> (batch.status[i])).ptr;
+          *out++ = '\n';
+        }
+      }
+      chunk.outputSize = static_cast<std::size_t> (out - chunk.output.data ());
+      chunk.records += batch.size;
+    }
+
+    bool looksLikeHeader (std::string_view line) {
+      return line[0] != '-' && line[0] != '+' && (line[0] < '0' || line[0] > '9');
+    }
+
+    // Parses, computes and formats one chunk. Stops at the first bad record with the
+    // results before it in the output.
+    void processChunk (Chunk& chunk, Batch& batch, const Options& options) {
+      chunk.outputSize = chunk.lines = chunk.records = chunk.errorAt = 0;
+      chunk.malformed = false;
+      batch.size = 0;
+      const auto drain = [&] {
+        batch.compute ();
+        appendResults (batch, options.outputFormat, chunk);
+        batch.size = 0;
+      };
+      const auto add = [&] {
+        const std::size_t i = batch.size;
+        if (!validRecord (batch.date[i], batch.lat[i], batch.lon[i])) {
+          return false;
+        }
+        if (++batch.size == batch.date.size ()) {
+          drain ();
+        }
+        return true;
+      };
+
+      std::string_view input = chunk.input;
+      if (options.inputFormat == Format::Binary) {
+        for (; !input.empty (); input.remove_prefix (kBinaryInputBytes)) {
+          ++chunk.lines;
+          decodeBinary (input.data (), batch.date[batch.size], batch.lat[batch.size],
+                        batch.lon[batch.size]);
+          if (!add ()) {
+            chunk.errorAt = chunk.lines;
+            break;
+          }
+        }
+        drain ();
+        return;
+      }
+      while (!input.empty ()) {
+        const std::size_t newline = input.find ('\n');
+        std::string_view line = input.substr (0, newline);
+        input.remove_prefix (newline == std::string_view::npos ? input.size () : newline + 1);
+        ++chunk.lines;
+        if (!line.empty () && line.back () == '\r') {
+          line.remove_suffix (1);
+        }
+        if (line.empty ()) {
+          continue;
+        }
+        if (chunk.index == 0 && chunk.lines == 1 && looksLikeHeader (line)) {
+          if (options.outputFormat == Format::Csv) {
+            constexpr std::string_view header = "rise,set,status\n";
+            chunk.output.resize (std::max (chunk.output.size (), header.size ()));
+            std::memcpy (chunk.output.data (), header.data (), header.size ());
+            chunk.outputSize = header.size ();
+          }
+          continue;
+        }
+        if (!parseCsv (line, batch.date[batch.size], batch.lat[batch.size],
+                       batch.lon[batch.size])) {
+          chunk.errorAt = chunk.lines;
+          chunk.malformed = true;
+          break;
+        }
+        if (!add ()) {
+          chunk.errorAt = chunk.lines;
+          break;
+        }
+      }
+      drain ();
+    }
+
+    // Wall time a stage spent working and blocked on its queues, summed over its threads
+    struct StageTime {
+      std::chrono::nanoseconds busy{ 0 };
+      std::chrono::nanoseconds stalled{ 0 };
+    };
+
+    double toSeconds (std::chrono::nanoseconds ns) {
+      return std::chrono::duration<double> (ns).count ();
+    }
+
+  } // namespace
+
+  bool parseFormat (std::string_view text, Format& format) {
+    if (text == "csv") {
+      format = Format::Csv;
+    } else if (text == "binary") {
+      format = Format::Binary;
+    } else {
+      return false;
+    }
+    return true;
+  }
+
+  int run (const Options& options) {
+    const unsigned threads = options.threads != 0
+                                 ? options.threads
+                                 : std::max (1u, std::thread::hardware_concurrency ());
+    ChunkReader reader (options.input, options.inputFormat, options.chunkRecords,
+                        options.readBufferBytes);
+    if (!reader.isOpen ()) {
+      LOG_E_STREAM << "Cannot open input " << options.input << std::endl;
+      return 1;
+    }
+    BufferedWriter writer (options.output, options.outputBytes);
+    if (!writer.isOpen ()) {
+      LOG_E_STREAM << "Cannot open output " << options.output << std::endl;
+      return 1;
+    }
+
+    // Every chunk is either free, being read, queued, computed or waiting for its turn
+    // at the writer; the pool size is the whole memory budget.
+    std::vector<Chunk> pool (std::size_t{ threads } * 2 + 2);
+    BoundedQueue<Chunk*> freeChunks (pool.size ());
+    BoundedQueue<Chunk*> work (pool.size ());
+    BoundedQueue<Chunk*> done (pool.size ());
+    for (Chunk& chunk : pool) {
+      freeChunks.push (&chunk);
+    }
+
+    const auto started = std::chrono::steady_clock::now ();
+    std::vector<StageTime> workerTimes (threads);
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; ++t) {
+      workers.emplace_back ([&, t] {
+        Batch batch (std::max<std::size_t> (options.batchSize, 1));
+        StageTime& time = workerTimes[t];
+        Chunk* chunk = nullptr;
+        while (work.pop (chunk, time.stalled)) {
+          const auto begin = std::chrono::steady_clock::now ();
+          processChunk (*chunk, batch, options);
+          time.busy += std::chrono::steady_clock::now () - begin;
+          done.push (chunk);
+        }
+      });
+    }
+
+    // Puts the chunks back in input order; a chunk with a bad record ends the output
+    StageTime writerTime;
+    std::size_t records = 0;
+    std::atomic<bool> parseFailed{ false };
+    std::thread writerThread ([&] {
+      std::vector<Chunk*> waiting (pool.size (), nullptr);
+      std::size_t nextIndex = 0;
+      std::size_t linesBefore = 0;
+      Chunk* chunk = nullptr;
+      while (done.pop (chunk, writerTime.stalled)) {
+        const auto begin = std::chrono::steady_clock::now ();
+        waiting[chunk->index % waiting.size ()] = chunk;
+        while ((chunk = waiting[nextIndex % waiting.size ()]) != nullptr) {
+          waiting[nextIndex % waiting.size ()] = nullptr;
+          ++nextIndex;
+          if (!parseFailed) {
+            writer.write (std::string_view (chunk->output.data (), chunk->outputSize));
+            records += chunk->records;
+            reader.release (chunk->input);
+            if (chunk->errorAt != 0) {
+              parseFailed = true;
+              const char* what = options.inputFormat == Format::Binary ? "Record " : "Line ";
+              if (chunk->malformed) {
+                LOG_E_STREAM << what << linesBefore + chunk->errorAt
+                             << ": expected YYYY-MM-DD,lat,lon" << std::endl;
+              } else {
+                LOG_E_STREAM << what << linesBefore + chunk->errorAt
+                             << ": invalid value, expected a date in " << kFirstYear << "-"
+                             << kLastYear << ", |lat| <= 90 and a finite lon" << std::endl;
+              }
+              freeChunks.close (); // stops the reader
+            }
+            linesBefore += chunk->lines;
+          }
+          freeChunks.push (chunk);
+        }
+        writerTime.busy += std::chrono::steady_clock::now () - begin;
+      }
+    });
+
+    // The calling thread is the reader
+    StageTime readerTime;
+    std::size_t chunkCount = 0;
+    Chunk* chunk = nullptr;
+    while (freeChunks.pop (chunk, readerTime.stalled) && !parseFailed) {
+      const auto begin = std::chrono::steady_clock::now ();
+      const std::string_view input = reader.next ();
+      if (input.empty ()) {
+        break;
+      }
+      if (reader.isMapped ()) {
+        chunk->input = input;
+      } else {
+        chunk->inputCopy.assign (input.begin (), input.end ());
+        chunk->input = std::string_view (chunk->inputCopy.data (), chunk->inputCopy.size ());
+      }
+      chunk->index = chunkCount++;
+      readerTime.busy += std::chrono::steady_clock::now () - begin;
+      work.push (chunk);
+    }
+    work.close ();
+    for (std::thread& worker : workers) {
+      worker.join ();
+    }
+    done.close ();
+    writerThread.join ();
+
+    if (parseFailed) {
+      writer.close ();
+      return 1;
+    }
+    if (reader.failed ()) {
+      LOG_E_STREAM << "Read error on " << options.input << std::endl;
+      return 1;
+    }
+    if (reader.trailingBytes () != 0) {
+      LOG_E_STREAM << "Input ends with a partial " << kBinaryInputBytes << "-byte record ("
+                   << reader.trailingBytes () << " bytes)" << std::endl;
+      return 1;
+    }
+    if (!writer.close ()) {
+      LOG_E_STREAM << "Write error on " << options.output << std::endl;
+      return 1;
+    }
+
+    const double seconds
+        = std::chrono::duration<double> (std::chrono::steady_clock::now () - started).count ();
+    StageTime compute;
+    for (const StageTime& time : workerTimes) {
+      compute.busy += time.busy;
+      compute.stalled += time.stalled;
+    }
+    // With --output - the console log is limited to errors because it shares stdout with
+    // the results, so the summary goes straight to stderr instead
+    const bool toStderr = options.output == "-";
+    const auto report = [toStderr] (const std::ostringstream& line) {
+      if (toStderr) {
+        std::cerr << line.str () << std::endl;
+      } else {
+        LOG_I_STREAM << line.str () << std::endl;
+      }
+    };
+    std::ostringstream line;
+    line << records << " records in " << seconds << " s ("
+         << static_cast<double> (records) / std::max (seconds, 1e-9) << " records/s), "
+         << chunkCount << " chunks, " << threads << " compute threads";
+    report (line);
+    // A stage that stalls waits on its neighbour: the reader for free chunks (the
+    // workers or the writer are behind), the workers for input (the reader is behind),
+    // the writer for the next chunk in order (the workers are behind).
+    line.str ("");
+    line << "reader  busy " << toSeconds (readerTime.busy) << " s, stalled "
+         << toSeconds (readerTime.stalled) << " s waiting for a free chunk";
+    report (line);
+    line.str ("");
+    line << "compute busy " << toSeconds (compute.busy) << " s, stalled "
+         << toSeconds (compute.stalled) << " s waiting for input (sum of " << threads
+         << " threads)";
+    report (line);
+    line.str ("");
+    line << "writer  busy " << toSeconds (writerTime.busy) << " s, stalled "
+         << toSeconds (writerTime.stalled) << " s waiting for the next chunk";
+    report (line);
+    return 0;
+  }
+
+} // namespace Bulk
@@ -0,0 +1,55 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+#ifndef __BULK_HPP
+#define __BULK_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// Streaming mode of SunrisetApp: one process answers a whole file of queries.
+//
+// csv input     one record per line, "YYYY-MM-DD,lat,lon"; a first line that does not
+//               start with a digit or a sign is taken as a header and skipped
+// binary input  20-byte records, native byte order:
+//               i16 year, u8 month, u8 day, f64 lat, f64 lon
+// csv output    "rise,set,status" per record, hours UT with 6 decimals and the
+//               __sunriset__ return code; a header line is written when the input had one
+// binary output 17-byte records: f64 rise, f64 set, i8 status
+//
+// Output rows follow the input order, one per record, so they can be pasted side by side.
+//
+// The input runs through a pipeline: the calling thread cuts it into chunks of whole
+// records, `threads` workers parse and compute chunks independently, and a writer thread
+// puts the results back in input order. The stages hand chunks over through bounded
+// queues from a fixed pool of 2 * threads + 2, so memory stays flat however large the
+// input is. Per-stage busy and stall times are logged at the end.
+namespace Bulk {
+
+  enum class Format { Csv, Binary };
+
+  constexpr std::size_t kBinaryInputBytes = 2 + 1 + 1 + 8 + 8;
+  constexpr std::size_t kBinaryOutputBytes = 8 + 8 + 1;
+
+  struct Options {
+    std::string input = "-";  // "-" is stdin
+    std::string output = "-"; // "-" is stdout
+    Format inputFormat = Format::Csv;
+    Format outputFormat = Format::Csv;
+    unsigned threads = 0;                   // compute workers, 0 for one per hardware thread
+    std::size_t chunkRecords = 16384;       // records per pipeline chunk
+    std::size_t batchSize = 4096;           // records computed together within a chunk
+    std::size_t readBufferBytes = 4u << 20; // stdin and pipes; also caps a chunk
+    std::size_t outputBytes = 4u << 20;     // output buffered before each write
+  };
+
+  // "csv" or "binary"
+  bool parseFormat (std::string_view text, Format& format);
+
+  // Returns the process exit code; errors are logged with the record number
+  int run (const Options& options);
+
+} // namespace Bulk
+
+#endif // __BULK_HPP
@@ -3,8 +3,11 @@
 
 #include "Logger/Logger.hpp"
 #include "Utils/Utils.hpp"
+#include "Sunriset/SolarTable.hpp"
 #include "Sunriset/Sunriset.hpp"
 
+#include "Bulk.hpp"
+
 #include <cxxopts.hpp>
 #include <filesystem>
 #include <fstream>
@@ -35,6 +38,8 @@ int processArguments (int argc, const char* argv[]) {
                              cxxopts::value<bool> ()->default_value ("false"));
     options->add_options () ("2,log2file", "Log to file",
                              cxxopts::value<bool> ()->default_value ("false"));
+    options->add_options () ("a,async-log", "Write log records from a background thread",
+                             cxxopts::value<bool> ()->default_value ("false"));
 
     options->add_options () ("y,year", "YEAR", cxxopts::value<int> ()->default_value ("2025"));
     options->add_options () ("m,month", "MONTH", cxxopts::value<int> ()->default_value ("4"));
@@ -46,6 +51,26 @@ int processArguments (int argc, const char* argv[]) {
     options->add_options () ("l,latitude", "LATITUDE",
                              cxxopts::value<double> ()->default_value ("49.86396819090531"));
 
+    options->add_options () ("table", "Answer from a SolarTable file in the assets directory",
+                             cxxopts::value<std::string> ());
+    options->add_options () ("site", "Site id to look up in --table",
+                             cxxopts::value<std::uint64_t> ()->default_value ("0"));
+
+    options->add_options () ("b,bulk", "Stream records (YYYY-MM-DD,lat,lon) from --input",
+                             cxxopts::value<bool> ()->default_value ("false"));
+    options->add_options () ("i,input", "Bulk input file, - for stdin",
+                             cxxopts::value<std::string> ()->default_value ("-"));
+    options->add_options () ("output", "Bulk output file, - for stdout",
+                             cxxopts::value<std::string> ()->default_value ("-"));
+    options->add_options () ("input-format", "Bulk input: csv or binary",
+                             cxxopts::value<std::string> ()->default_value ("csv"));
+    options->add_options () ("output-format", "Bulk output: csv or binary",
+                             cxxopts::value<std::string> ()->default_value ("csv"));
+    options->add_options () ("t,threads", "Bulk compute threads, 0 for one per CPU",
+                             cxxopts::value<unsigned> ()->default_value ("0"));
+    options->add_options () ("chunk-size", "Bulk records per pipeline chunk",
+                             cxxopts::value<std::size_t> ()->default_value ("16384"));
+
     const auto result = options->parse (argc, argv);
 
     if (result.count ("help")) {
@@ -53,11 +78,64 @@ int processArguments (int argc, const char* argv[]) {
       return 0;
     }
 
+    if (result["bulk"].as<bool> () && result["output"].as<std::string> () == "-") {
+      // the console sink shares stdout with the bulk results: errors go to stderr, and
+      // nothing, not even a colour escape, may be written to stdout
+      LOG.setLevel (Logger::Level::LOG_ERROR);
+      LOG.showConsoleColor (false);
+    }
+    LOG_D_STREAM << "Starting " << Config::standaloneName << " ..." << std::endl;
+
+    if (result["async-log"].as<bool> ()) {
+      LOG.startAsync ();
+    }
+
     if (result["log2file"].as<bool> ()) {
       LOG.enableFileLogging (std::string (Config::standaloneName) + ".log");
       LOG_D_STREAM << "Logging to file enabled [-2]" << std::endl;
     }
 
+    if (!result.unmatched ().empty ()) {
+      for (const auto& arg : result.unmatched ()) {
+        LOG_E_STREAM << "Unrecognized option: " << arg << std::endl;
+      }
+      LOG_I_STREAM << options->help () << std::endl;
+      return 1;
+    }
+
+    if (result["bulk"].as<bool> ()) {
+      Bulk::Options bulk;
+      bulk.input = result["input"].as<std::string> ();
+      bulk.output = result["output"].as<std::string> ();
+      bulk.threads = result["threads"].as<unsigned> ();
+      bulk.chunkRecords = result["chunk-size"].as<std::size_t> ();
+      if (!Bulk::parseFormat (result["input-format"].as<std::string> (), bulk.inputFormat)
+          || !Bulk::parseFormat (result["output-format"].as<std::string> (), bulk.outputFormat)) {
+        LOG_E_STREAM << "Bulk formats are csv or binary" << std::endl;
+        return 1;
+      }
+      return Bulk::run (bulk);
+    }
+
+    if (result.count ("table")) {
+      uniqueLib = std::make_unique<dotname::Sunriset> (Config::assetsPath);
+      if (!uniqueLib->openTable (result["table"].as<std::string> ())) {
+        return 1;
+      }
+      dotname::SolarEventTimes times;
+      if (!uniqueLib->getTable ()->lookup (result["site"].as<std::uint64_t> (),
+                                           result["year"].as<int> (), result["month"].as<int> (),
+                                           result["day"].as<int> (),
+                                           dotname::SolarEvent::SunriseSunset, times)) {
+        LOG_E_STREAM << "Site " << result["site"].as<std::uint64_t> ()
+                     << " or the date is not in the table" << std::endl;
+        return 1;
+      }
+      LOG_I_STREAM << "Sunrise: " << uniqueLib->doubleTo24Time (times.start) << " "
+                   << "Sunset: " << uniqueLib->doubleTo24Time (times.end) << std::endl;
+      return 0;
+    }
+
     if (!result.count ("omit")) {
       // uniqueLib = std::make_unique<dotname::Sunriset> ();
       // uniqueLib = std::make_unique<dotname::Sunriset> (Config::assetsPath);
@@ -69,14 +147,6 @@ int processArguments (int argc, const char* argv[]) {
       LOG_D_STREAM << "Loading library omitted [-o]" << std::endl;
     }
 
-    if (!result.unmatched ().empty ()) {
-      for (const auto& arg : result.unmatched ()) {
-        LOG_E_STREAM << "Unrecognized option: " << arg << std::endl;
-      }
-      LOG_I_STREAM << options->help () << std::endl;
-      return 1;
-    }
-
   } catch (const cxxopts::exceptions::exception& e) {
     LOG_E_STREAM << "error parsing options: " << e.what () << std::endl;
     return 1;
@@ -86,7 +156,6 @@ int processArguments (int argc, const char* argv[]) {
 
 int main (int argc, const char* argv[]) {
   LOG.noHeader (true);
-  LOG_D_STREAM << "Starting " << Config::standaloneName << " ..." << std::endl;
   if (processArguments (argc, argv) != 0) {
     return 1;
   }
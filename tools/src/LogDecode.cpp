@@ -0,0 +1,256 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+// Renders a binary log written by Logger::enableBinaryLogging as the text the file sink
+// would have produced, with microsecond timestamps:
+//   SunrisetLogDecode app.blog [more.blog ...]
+
+#include <Logger/Logger.hpp>
+
+#include <fmt/args.h>
+#include <fmt/format.h>
+
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+  struct Format {
+    int level;
+    std::string format;
+    std::string caller;
+  };
+
+  struct Clock {
+    std::uint64_t ticks, steadyNs;
+  };
+
+  // Events wait for the Clock record closing their block, which fixes the tick rate
+  struct Pending {
+    std::uint64_t ticks;
+    const Format* format;
+    std::string message;
+  };
+
+  class Reader {
+  public:
+    explicit Reader (std::vector<char> bytes) : bytes_ (std::move (bytes)) {}
+
+    bool atEnd () const {
+      return pos_ == bytes_.size ();
+    }
+
+    template <typename T> bool get (T& value) {
+      if (bytes_.size () - pos_ < sizeof value)
+        return false;
+      std::memcpy (&value, bytes_.data () + pos_, sizeof value);
+      pos_ += sizeof value;
+      return true;
+    }
+
+    bool getString (std::string& text) {
+      std::uint32_t size = 0;
+      if (!get (size) || bytes_.size () - pos_ < size)
+        return false;
+      text.assign (bytes_.data () + pos_, size);
+      pos_ += size;
+      return true;
+    }
+
+    std::size_t position () const {
+      return pos_;
+    }
+
+  private:
+    std::vector<char> bytes_;
+    std::size_t pos_ = 0;
+  };
+
+  std::string wallTime (std::uint64_t ns) {
+    const std::time_t seconds = static_cast<std::time_t> (ns / 1000000000u);
+    std::tm tm;
+#ifdef _WIN32
+    localtime_s (&tm, &seconds);
+#else
+    localtime_r (&seconds, &tm);
+#endif
+    char text[48];
+    const std::size_t n = std::strftime (text, sizeof text, "%d-%m-%Y %H:%M:%S", &tm);
+    std::snprintf (text + n, sizeof text - n, ".%06u",
+                   static_cast<unsigned> (ns % 1000000000u / 1000u));
+    return text;
+  }
+
+  using ArgStore = fmt::dynamic_format_arg_store<fmt::format_context>;
+
+  template <typename Raw> bool pushArg (Reader& in, ArgStore& args) {
+    Raw value;
+    if (!in.get (value))
+      return false;
+    args.push_back (value);
+    return true;
+  }
+
+  bool readArg (Reader& in, ArgStore& args) {
+    std::uint8_t tag = 0;
+    if (!in.get (tag))
+      return false;
+    switch (static_cast<BinaryLog::ArgTag> (tag)) {
+    case BinaryLog::ArgTag::Int:
+      return pushArg<std::int64_t> (in, args);
+    case BinaryLog::ArgTag::UInt:
+      return pushArg<std::uint64_t> (in, args);
+    case BinaryLog::ArgTag::Double:
+      return pushArg<double> (in, args);
+    case BinaryLog::ArgTag::Float:
+      return pushArg<float> (in, args);
+    case BinaryLog::ArgTag::Char:
+      return pushArg<char> (in, args);
+    case BinaryLog::ArgTag::Bool: {
+      std::uint8_t value;
+      if (!in.get (value))
+        return false;
+      args.push_back (value != 0);
+      return true;
+    }
+    case BinaryLog::ArgTag::String: {
+      std::string value;
+      if (!in.getString (value))
+        return false;
+      args.push_back (value);
+      return true;
+    }
+    case BinaryLog::ArgTag::Pointer: {
+      std::uint64_t value;
+      if (!in.get (value))
+        return false;
+      args.push_back (reinterpret_cast<const void*> (static_cast<std::uintptr_t> (value)));
+      return true;
+    }
+    }
+    return false;
+  }
+
+  // An event may carry ticks slightly before the Clock record opening its block, so the
+  // offset is signed
+  std::uint64_t toSteadyNs (std::uint64_t ticks, const Clock& from, const Clock& to) {
+    if (to.ticks == from.ticks)
+      return from.steadyNs;
+    const double rate = static_cast<double> (to.steadyNs - from.steadyNs)
+                        / static_cast<double> (to.ticks - from.ticks);
+    const auto offset = static_cast<std::int64_t> (ticks - from.ticks);
+    return from.steadyNs
+           + static_cast<std::uint64_t> (
+               static_cast<std::int64_t> (static_cast<double> (offset) * rate));
+  }
+
+  int decode (const char* path) {
+    std::ifstream file (path, std::ios::binary);
+    if (!file) {
+      std::fprintf (stderr, "%s: cannot open\n", path);
+      return 1;
+    }
+    Reader in (std::vector<char> ((std::istreambuf_iterator<char> (file)),
+                                  std::istreambuf_iterator<char> ()));
+
+    char magic[sizeof BinaryLog::kMagic];
+    std::uint64_t systemAnchor = 0, steadyAnchor = 0;
+    if (!in.get (magic) || std::memcmp (magic, BinaryLog::kMagic, sizeof magic) != 0
+        || !in.get (systemAnchor) || !in.get (steadyAnchor)) {
+      std::fprintf (stderr, "%s: not a binary log\n", path);
+      return 1;
+    }
+
+    std::unordered_map<std::uint32_t, Format> formats;
+    std::vector<Pending> pending;
+    Clock previous{ 0, 0 };
+    bool haveClock = false;
+    const auto print = [&] (const Clock& from, const Clock& to) {
+      for (const Pending& p : pending) {
+        const std::uint64_t steady = toSteadyNs (p.ticks, from, to);
+        std::printf ("[%s] [%s] [%s] %s\n",
+                     wallTime (systemAnchor + (steady - steadyAnchor)).c_str (),
+                     p.format->caller.empty () ? "empty caller" : p.format->caller.c_str (),
+                     LOG.levelToString (static_cast<Logger::Level> (p.format->level)).c_str (),
+                     p.message.c_str ());
+      }
+      pending.clear ();
+    };
+
+    while (!in.atEnd ()) {
+      const std::size_t recordStart = in.position ();
+      std::uint8_t kind = 0;
+      std::uint32_t id = 0;
+      bool ok = in.get (kind);
+      if (ok && kind == static_cast<std::uint8_t> (BinaryLog::Kind::Clock)) {
+        Clock clock;
+        ok = in.get (clock.ticks) && in.get (clock.steadyNs);
+        if (ok) {
+          print (haveClock ? previous : clock, clock);
+          previous = clock;
+          haveClock = true;
+        }
+      } else if (ok && kind == static_cast<std::uint8_t> (BinaryLog::Kind::Define)) {
+        std::uint8_t level = 0;
+        Format f;
+        ok = in.get (id) && in.get (level) && in.getString (f.format) && in.getString (f.caller);
+        f.level = level;
+        if (ok)
+          formats[id] = std::move (f);
+      } else if (ok && kind == static_cast<std::uint8_t> (BinaryLog::Kind::Event)) {
+        std::uint64_t ticks = 0;
+        std::uint8_t count = 0;
+        ArgStore args;
+        ok = in.get (id) && in.get (ticks) && in.get (count);
+        for (unsigned i = 0; ok && i < count; ++i)
+          ok = readArg (in, args);
+        const auto f = formats.find (id);
+        if (ok && f != formats.end ()) {
+          std::string message;
+          try {
+            message = fmt::vformat (f->second.format, args);
+          } catch (const fmt::format_error& e) {
+            message = f->second.format + " <" + e.what () + ">";
+          }
+          pending.push_back ({ ticks, &f->second, std::move (message) });
+        } else if (ok) {
+          std::fprintf (stderr, "%s: event with undefined format id %u at byte %zu\n", path, id,
+                        recordStart);
+          return 1;
+        }
+      } else {
+        ok = false;
+      }
+      if (!ok) {
+        print (previous, previous);
+        std::fprintf (stderr, "%s: truncated or corrupt record at byte %zu\n", path, recordStart);
+        return 1;
+      }
+    }
+    if (!pending.empty ()) {
+      // the writer did not close the file; times are those of the last clock record
+      print (previous, previous);
+      std::fprintf (stderr, "%s: no closing clock record\n", path);
+      return 1;
+    }
+    return 0;
+  }
+
+} // namespace
+
+int main (int argc, char** argv) {
+  if (argc < 2) {
+    std::fprintf (stderr, "usage: %s <binary log> [...]\n", argv[0]);
+    return 2;
+  }
+  int status = 0;
+  for (int i = 1; i < argc; ++i)
+    status |= decode (argv[i]);
+  return status;
+}
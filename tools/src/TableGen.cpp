@@ -0,0 +1,88 @@
+// MIT License
+// Copyright (c) 2024-2025 Tomáš Mark
+
+// Writes a dotname::SolarTable for a list of sites, e.g. to ship as an asset:
+//   SunrisetTableGen sites.csv assets/sites-2025.srt 2025 [dayCount] [eventMask]
+// sites.csv holds "id,lat,lon" per line; a first line that is not a record is skipped.
+// The table starts on January 1st of the year and covers dayCount days (default: the
+// whole year); eventMask is bit (1 << SolarEvent), 15 for all four events.
+
+#include <Sunriset/SolarTable.hpp>
+#include <Sunriset/Sunriset.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+  bool parseSite (const std::string& line, dotname::SolarTable::Site& site) {
+    const char* p = line.c_str ();
+    char* end = nullptr;
+    site.id = std::strtoull (p, &end, 10);
+    if (end == p || *end != ',')
+      return false;
+    p = end + 1;
+    site.lat = std::strtod (p, &end);
+    if (end == p || *end != ',')
+      return false;
+    p = end + 1;
+    site.lon = std::strtod (p, &end);
+    while (*end == ' ' || *end == '\r')
+      ++end;
+    return end != p && *end == '\0';
+  }
+
+  bool isLeapYear (int year) {
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+  }
+
+} // namespace
+
+int main (int argc, char** argv) {
+  if (argc < 4 || argc > 6) {
+    std::fprintf (stderr, "usage: %s <sites.csv> <table> <year> [dayCount] [eventMask]\n",
+                  argv[0]);
+    return 2;
+  }
+  const int year = std::atoi (argv[3]);
+  const long dayCount = argc > 4 ? std::atol (argv[4]) : (isLeapYear (year) ? 366 : 365);
+  const long eventMask = argc > 5 ? std::atol (argv[5]) : dotname::SolarTable::kAllEvents;
+  if (year < 1801 || year > 2099 || dayCount < 1 || eventMask < 0 || eventMask > 15) {
+    std::fprintf (stderr, "year must be 1801-2099, dayCount positive, eventMask 0-15\n");
+    return 2;
+  }
+
+  std::ifstream in (argv[1]);
+  if (!in) {
+    std::fprintf (stderr, "%s: cannot open\n", argv[1]);
+    return 1;
+  }
+  std::vector<dotname::SolarTable::Site> sites;
+  std::string line;
+  for (std::size_t number = 1; std::getline (in, line); ++number) {
+    dotname::SolarTable::Site site;
+    if (line.empty () || line == "\r")
+      continue;
+    if (!parseSite (line, site)) {
+      if (number == 1)
+        continue; // header
+      std::fprintf (stderr, "%s:%zu: expected id,lat,lon\n", argv[1], number);
+      return 1;
+    }
+    sites.push_back (site);
+  }
+
+  const auto started = std::chrono::steady_clock::now ();
+  if (!dotname::SolarTable::generate (argv[2], sites, year, 1, 1,
+                                      static_cast<std::size_t> (dayCount),
+                                      static_cast<std::uint8_t> (eventMask)))
+    return 1;
+  const double seconds
+      = std::chrono::duration<double> (std::chrono::steady_clock::now () - started).count ();
+  std::printf ("%s: %zu sites x %ld days in %.2f s\n", argv[2], sites.size (), dayCount, seconds);
+  return 0;
+}